@@ -219,6 +219,19 @@ static constexpr char inference_only_message[] =
     " To enable full mode for static models pass \"false\" value to this argument:"
     " ex. \"-inference_only=false\".\n";
 
+static constexpr char rate_message[] =
+    "Optional. Target rate of inference requests per second for open-loop load generation."
+    " Requests are issued on schedule regardless of completion of the previous ones and latency is measured"
+    " from the scheduled issue time, so queueing delay is reported separately from execution time."
+    " Requires async API. Default value is 0 (closed loop, maximum throughput).";
+
+static constexpr char arrival_message[] =
+    "Optional. Arrival process of open-loop load generation: \"constant\" or \"poisson\"."
+    " Default value is \"constant\".";
+
+static constexpr char load_report_message[] =
+    "Optional. Path to a .json file to dump latency percentiles of open-loop load generation to.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -352,6 +365,15 @@ DEFINE_string(imean, "", input_image_mean_message);
 /// @brief Define flag for inference only mode <br>
 DEFINE_bool(inference_only, true, inference_only_message);
 
+/// @brief Define parameter for open-loop request rate <br>
+DEFINE_double(rate, 0, rate_message);
+
+/// @brief Define parameter for open-loop arrival process <br>
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Define parameter for open-loop load report path <br>
+DEFINE_string(load_report, "", load_report_message);
+
 /**
  * @brief This function show a help message
  */
@@ -381,6 +403,8 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -rate \"<double>\"          " << rate_message << std::endl;
+    std::cout << "    -arrival \"<type>\"         " << arrival_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -395,6 +419,7 @@ static void show_usage() {
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
+    std::cout << "    -load_report \"<path>\"     " << load_report_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
     std::cout << "    -qb                       " << gna_qb_message << std::endl;
@@ -51,6 +51,16 @@ public:
         _request.start_async();
     }
 
+    /// @brief Sets the time the request was intended to be issued at by open-loop load generator
+    void set_scheduled_time(Time::time_point scheduledTime) {
+        _scheduledTime = scheduledTime;
+        _isScheduled = true;
+    }
+
+    bool is_scheduled() const {
+        return _isScheduled;
+    }
+
     void wait() {
         _request.wait();
     }
@@ -84,6 +94,16 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queueing_time_in_milliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _scheduledTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
+    double get_scheduled_latency_in_milliseconds() const {
+        auto latency = std::chrono::duration_cast<ns>(_endTime - _scheduledTime);
+        return static_cast<double>(latency.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -99,6 +119,8 @@ private:
     ov::runtime::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    Time::time_point _scheduledTime;
+    bool _isScheduled = false;
     size_t _id;
     size_t _lat_group_id;
     QueueCallbackFunction _callbackQueue;
@@ -137,6 +159,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
+        _scheduledLatencies.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -149,6 +173,11 @@ public:
     void put_idle_request(size_t id, size_t lat_group_id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        const auto& request = requests.at(id);
+        if (request->is_scheduled()) {
+            _queueingTimes.push_back(request->get_queueing_time_in_milliseconds());
+            _scheduledLatencies.push_back(request->get_scheduled_latency_in_milliseconds());
+        }
         if (enable_lat_groups) {
             _latency_groups[lat_group_id].push_back(latency);
         }
@@ -183,6 +212,14 @@ public:
         return _latency_groups;
     }
 
+    std::vector<double> get_queueing_times() {
+        return _queueingTimes;
+    }
+
+    std::vector<double> get_scheduled_latencies() {
+        return _scheduledLatencies;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -192,6 +229,8 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
+    std::vector<double> _scheduledLatencies;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
 };
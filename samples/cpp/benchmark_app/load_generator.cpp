@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "load_generator.hpp"
+#include "statistics_report.hpp"
+// clang-format on
+
+namespace {
+const std::vector<double> reportedPercentiles = {50.0, 90.0, 99.0, 99.9};
+
+std::string percentile_name(double p) {
+    std::stringstream ss;
+    ss << "p" << p;
+    return ss.str();
+}
+}  // namespace
+
+ArrivalSchedule::ArrivalSchedule(double rate, const std::string& arrival, unsigned int seed)
+    : _rate(rate),
+      _arrival(arrival),
+      _generator(seed),
+      _poisson(rate) {
+    if (rate <= 0) {
+        throw std::logic_error("Request rate must be positive for open-loop load generation.");
+    }
+    if (arrival != constantArrival && arrival != poissonArrival) {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `" +
+                               std::string(constantArrival) + "` or `" + std::string(poissonArrival) + "` value.");
+    }
+}
+
+void ArrivalSchedule::start(Time::time_point startTime) {
+    _next = startTime;
+}
+
+Time::time_point ArrivalSchedule::next() {
+    auto current = _next;
+    const double interval_s = (_arrival == poissonArrival) ? _poisson(_generator) : 1.0 / _rate;
+    _next += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval_s));
+    return current;
+}
+
+void log_load_point(const LoadPoint& point) {
+    slog::info << "Offered load:  " << double_to_string(point.offeredRate) << " requests/s" << slog::endl;
+    slog::info << "Achieved load: " << double_to_string(point.achievedRate) << " requests/s" << slog::endl;
+    auto log_metrics = [](const std::string& name, const std::vector<double>& values) {
+        LatencyMetrics metrics(values);
+        slog::info << name << slog::endl;
+        for (auto p : reportedPercentiles) {
+            slog::info << "\t" << percentile_name(p) << ":\t" << double_to_string(metrics.percentile(p)) << " ms"
+                       << slog::endl;
+        }
+        slog::info << "\tMax:\t" << double_to_string(metrics.max()) << " ms" << slog::endl;
+    };
+    log_metrics("Queueing delay:", point.queueingTimes);
+    log_metrics("Execution time:", point.executionTimes);
+    log_metrics("Latency (corrected for coordinated omission):", point.latencies);
+}
+
+void dump_load_report(const std::string& path, const std::string& arrival, const LoadPoint& point) {
+    auto metrics_to_json = [](const std::vector<double>& values) {
+        LatencyMetrics metrics(values);
+        nlohmann::json json;
+        for (auto p : reportedPercentiles) {
+            json[percentile_name(p)] = metrics.percentile(p);
+        }
+        json["avg"] = metrics.average();
+        json["min"] = metrics.min();
+        json["max"] = metrics.max();
+        return json;
+    };
+
+    nlohmann::json report;
+    report["arrival"] = arrival;
+    report["offered_rate"] = point.offeredRate;
+    report["achieved_rate"] = point.achievedRate;
+    report["requests"] = point.requestsCount;
+    report["queueing_ms"] = metrics_to_json(point.queueingTimes);
+    report["execution_ms"] = metrics_to_json(point.executionTimes);
+    report["latency_ms"] = metrics_to_json(point.latencies);
+
+    std::ofstream ofs(path);
+    if (!ofs.is_open()) {
+        throw std::runtime_error("Can't open file " + path + " to dump load report");
+    }
+    ofs << report.dump(4);
+    slog::info << "Load report is stored to " << path << slog::endl;
+}
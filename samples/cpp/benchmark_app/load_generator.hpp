@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "utils.hpp"
+// clang-format on
+
+static constexpr char constantArrival[] = "constant";
+static constexpr char poissonArrival[] = "poisson";
+
+/// @brief Generates intended issue times of inference requests for open-loop load generation.
+/// Schedule does not depend on the completion of previous requests, so the latency measured from the
+/// intended time is free of coordinated omission.
+class ArrivalSchedule {
+public:
+    ArrivalSchedule(double rate, const std::string& arrival, unsigned int seed = 0);
+
+    /// @brief Sets the time the schedule starts from
+    void start(Time::time_point startTime);
+
+    /// @brief Returns intended issue time of the next request
+    Time::time_point next();
+
+    double rate() const {
+        return _rate;
+    }
+
+    const std::string& arrival() const {
+        return _arrival;
+    }
+
+private:
+    double _rate;
+    std::string _arrival;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _poisson;
+    Time::time_point _next;
+};
+
+/// @brief Latency results of one open-loop run
+struct LoadPoint {
+    double offeredRate;
+    double achievedRate;
+    size_t requestsCount;
+    std::vector<double> queueingTimes;
+    std::vector<double> executionTimes;
+    std::vector<double> latencies;
+};
+
+/// @brief Prints percentiles of queueing delay, execution time and total latency of the run
+void log_load_point(const LoadPoint& point);
+
+/// @brief Dumps results of the run to .json file
+void dump_load_report(const std::string& path, const std::string& arrival, const LoadPoint& point);
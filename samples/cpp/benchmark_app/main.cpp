@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -25,6 +26,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "progress_bar.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
@@ -56,6 +58,16 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_rate < 0) {
+        throw std::logic_error("The request rate is incorrect. Please set -rate option to a positive value.");
+    }
+    if (FLAGS_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load generation (-rate option) requires async API.");
+    }
+    if (FLAGS_arrival != constantArrival && FLAGS_arrival != poissonArrival) {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `" +
+                               std::string(constantArrival) + "` or `" + std::string(poissonArrival) + "` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
@@ -875,9 +887,20 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
+        // open-loop load generation issues requests on schedule instead of on completion of the previous ones
+        std::unique_ptr<ArrivalSchedule> schedule;
+        if (FLAGS_rate > 0) {
+            schedule.reset(new ArrivalSchedule(FLAGS_rate, FLAGS_arrival));
+            slog::info << "Requests are issued at " << FLAGS_rate << " requests/s (" << FLAGS_arrival << " arrival)"
+                       << slog::endl;
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        if (schedule) {
+            schedule->start(startTime);
+        }
 
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
@@ -885,11 +908,21 @@ int main(int argc, char* argv[]) {
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !schedule && iteration % nireq != 0)) {
+            Time::time_point scheduledTime;
+            if (schedule) {
+                scheduledTime = schedule->next();
+                std::this_thread::sleep_until(scheduledTime);
+            }
+
+            // in open-loop mode waiting for an idle request is accounted as queueing delay
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 IE_THROW() << "No idle Infer Requests!";
             }
+            if (schedule) {
+                inferRequest->set_scheduled_time(scheduledTime);
+            }
 
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
@@ -973,6 +1006,16 @@ int main(int argc, char* argv[]) {
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / generalLatency.percentile(FLAGS_latency_percentile)
                                            : 1000.0 * processedFramesN / totalDuration;
 
+        std::unique_ptr<LoadPoint> loadPoint;
+        if (schedule) {
+            loadPoint.reset(new LoadPoint{schedule->rate(),
+                                          1000.0 * iteration / totalDuration,
+                                          iteration,
+                                          inferRequestsQueue.get_queueing_times(),
+                                          inferRequestsQueue.get_latencies(),
+                                          inferRequestsQueue.get_scheduled_latencies()});
+        }
+
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {
@@ -1042,6 +1085,18 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {{"throughput", double_to_string(fps)}});
+            if (loadPoint) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {
+                        {"offered load (requests/s)", double_to_string(loadPoint->offeredRate)},
+                        {"achieved load (requests/s)", double_to_string(loadPoint->achievedRate)},
+                        {"p99 queueing delay (ms)",
+                         double_to_string(LatencyMetrics(loadPoint->queueingTimes).percentile(99))},
+                        {"p99 latency from schedule (ms)",
+                         double_to_string(LatencyMetrics(loadPoint->latencies).percentile(99))},
+                    });
+            }
         }
         progressBar.finish();
 
@@ -1109,6 +1164,13 @@ int main(int argc, char* argv[]) {
         }
         slog::info << "Throughput: " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (loadPoint) {
+            log_load_point(*loadPoint);
+            if (!FLAGS_load_report.empty()) {
+                dump_load_report(FLAGS_load_report, FLAGS_arrival, *loadPoint);
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
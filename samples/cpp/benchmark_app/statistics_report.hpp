@@ -49,8 +49,8 @@ public:
         return std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
     }
 
-    double percentile(std::size_t p) {
-        return latencies[size_t(latencies.size() / 100.0 * p)];
+    double percentile(double p) {
+        return latencies[std::min(size_t(latencies.size() / 100.0 * p), latencies.size() - 1)];
     }
 
     double max() {
@@ -60,12 +60,16 @@ def get_input_types(obj: Union[InferRequestBase, CompiledModelBase]) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest wrapper."""
 
-    def infer(self, inputs: Union[dict, list] = None) -> dict:
-        """Infer wrapper for InferRequest."""
+    def infer(self, inputs: Union[dict, list] = None, shared_memory: bool = False) -> dict:
+        """Infer wrapper for InferRequest.
+
+        If shared_memory is True, returned arrays share memory with the output tensors of
+        the request and are overwritten by the next inference.
+        """
         inputs = (
             {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
         )
-        return super().infer(inputs)
+        return super().infer(inputs, shared_memory)
 
     def start_async(self, inputs: Union[dict, list] = None, userdata: Any = None) -> None:
         """Asynchronous infer wrapper for InferRequest."""
@@ -108,6 +112,16 @@ class AsyncInferQueue(AsyncInferQueueBase):
         )
         super().start_async(inputs, userdata)
 
+    def start_async_batch(self, inputs: List[Union[dict, list]], userdata: List[Any] = None) -> None:
+        """Start several asynchronous inferences with a single GIL release."""
+        if userdata is None:
+            userdata = [None] * len(inputs)
+        input_types = get_input_types(self[0])
+        super().start_async_batch(
+            [{} if inp is None else normalize_inputs(inp, input_types) for inp in inputs],
+            userdata,
+        )
+
 
 class Core(CoreBase):
     """Core wrapper."""
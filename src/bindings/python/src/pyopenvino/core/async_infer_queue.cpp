@@ -57,6 +57,35 @@ public:
         return _idle_handles.front();
     }
 
+    size_t pop_idle_request_id() {
+        // Wait for any of _idle_handles and take it from the queue
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] {
+            return !(_idle_handles.empty());
+        });
+        if (_errors.size() > 0)
+            throw _errors.front();
+        size_t handle = _idle_handles.front();
+        _idle_handles.pop();
+        return handle;
+    }
+
+    void return_idle_requests(const std::vector<size_t>& handles) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto handle : handles) {
+                _idle_handles.push(handle);
+            }
+        }
+        _cv.notify_all();
+    }
+
+    bool has_idle_request() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return !(_idle_handles.empty());
+    }
+
     void wait_all() {
         // Wait for all requests to return with callback thus updating
         // _idle_handles so it matches the size of requests
@@ -73,8 +102,11 @@ public:
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
-                // Add idle handle to queue
-                _idle_handles.push(handle);
+                {
+                    // Add idle handle to queue
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _idle_handles.push(handle);
+                }
                 // Notify locks in getIdleRequestId() or waitAll() functions
                 _cv.notify_one();
             });
@@ -92,24 +124,54 @@ public:
                 } catch (const std::exception& e) {
                     throw ov::Exception(e.what());
                 }
-                // Acquire GIL, execute Python function
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _completed_handles.push(handle);
+                    // Another thread already holds the GIL and executes callbacks, it will process this request too
+                    if (_dispatching)
+                        return;
+                    _dispatching = true;
+                }
+                // Acquire GIL once and execute Python function for every request completed meanwhile
                 py::gil_scoped_acquire acquire;
-                try {
-                    f_callback(_requests[handle], _user_ids[handle]);
-                } catch (py::error_already_set py_error) {
-                    assert(PyErr_Occurred());
-                    _errors.push(py_error);
+                while (true) {
+                    size_t completed;
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (_completed_handles.empty()) {
+                            _dispatching = false;
+                            break;
+                        }
+                        completed = _completed_handles.front();
+                        _completed_handles.pop();
+                    }
+                    try {
+                        f_callback(_requests[completed], _user_ids[completed]);
+                    } catch (py::error_already_set py_error) {
+                        assert(PyErr_Occurred());
+                        _errors.push(py_error);
+                    }
+                    {
+                        // Add idle handle to queue
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _idle_handles.push(completed);
+                    }
+                    // Notify locks in getIdleRequestId() or waitAll() functions
+                    _cv.notify_one();
                 }
-                // Add idle handle to queue
-                _idle_handles.push(handle);
-                // Notify locks in getIdleRequestId() or waitAll() functions
-                _cv.notify_one();
             });
         }
     }
 
+    void start_async(size_t handle) {
+        _requests[handle]._start_time = Time::now();
+        _requests[handle]._request.start_async();
+    }
+
     std::vector<InferRequestWrapper> _requests;
     std::queue<size_t> _idle_handles;
+    std::queue<size_t> _completed_handles;
+    bool _dispatching = false;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
     std::mutex _mutex;
     std::condition_variable _cv;
@@ -148,8 +210,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const py::dict inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            self._idle_handles.pop();
+            auto handle = self.pop_idle_request_id();
             // Set new inputs label/id from user
             self._user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -157,10 +218,47 @@ void regclass_AsyncInferQueue(py::module m) {
             // Now GIL can be released - we are NOT working with Python objects in this block
             {
                 py::gil_scoped_release release;
-                self._requests[handle]._start_time = Time::now();
                 // Start InferRequest in asynchronus mode
-                self._requests[handle]._request.start_async();
+                self.start_async(handle);
+            }
+        },
+        py::arg("inputs"),
+        py::arg("userdata"));
+
+    cls.def(
+        "start_async_batch",
+        [](AsyncInferQueue& self, const py::list inputs, const py::list userdata) {
+            if (inputs.size() != userdata.size()) {
+                throw py::value_error("Number of inputs (" + std::to_string(inputs.size()) +
+                                      ") doesn't match number of userdata objects (" +
+                                      std::to_string(userdata.size()) + ")!");
+            }
+            // Requests are prepared while holding the GIL and started with a single GIL release,
+            // pending requests are started earlier only if the queue runs out of idle requests
+            std::vector<size_t> handles;
+            auto start_pending = [&self, &handles]() {
+                py::gil_scoped_release release;
+                for (auto handle : handles) {
+                    self.start_async(handle);
+                }
+                handles.clear();
+            };
+            for (size_t i = 0; i < inputs.size(); i++) {
+                if (!handles.empty() && !self.has_idle_request()) {
+                    start_pending();
+                }
+                auto handle = self.pop_idle_request_id();
+                handles.push_back(handle);
+                try {
+                    self._user_ids[handle] = userdata[i];
+                    Common::set_request_tensors(self._requests[handle]._request, inputs[i].cast<py::dict>());
+                } catch (...) {
+                    // Return requests which were not started back to the queue
+                    self.return_idle_requests(handles);
+                    throw;
+                }
             }
+            start_pending();
         },
         py::arg("inputs"),
         py::arg("userdata"));
@@ -315,10 +315,25 @@ uint32_t get_optimal_number_of_requests(const ov::runtime::CompiledModel& actual
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::runtime::InferRequest& request) {
+py::array tensor_to_numpy(const ov::runtime::Tensor& tensor) {
+    // Python Tensor object is used as a base, so array keeps tensor's memory alive without copying
+    return py::array(ov_type_to_dtype().at(tensor.get_element_type()),
+                     tensor.get_shape(),
+                     tensor.get_strides(),
+                     tensor.data(),
+                     py::cast(tensor));
+}
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::runtime::InferRequest& request,
+                         bool shared_memory) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::runtime::Tensor t{request.get_tensor(out)};
+        if (shared_memory) {
+            res[py::cast(out)] = tensor_to_numpy(t);
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
@@ -44,7 +44,11 @@ PyAny from_ov_any(const ov::Any& any);
 
 uint32_t get_optimal_number_of_requests(const ov::runtime::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::runtime::InferRequest& request);
+py::array tensor_to_numpy(const ov::runtime::Tensor& tensor);
+
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::runtime::InferRequest& request,
+                         bool shared_memory = false);
 
 // Use only with classes that are not creatable by users on Python's side, because
 // Objects created in Python that are wrapped with such wrapper will cause memory leaks.
@@ -33,8 +33,12 @@ void regclass_CompiledModel(py::module m) {
             auto request = self.create_infer_request();
             // Update inputs if there are any
             Common::set_request_tensors(request, inputs);
-            request.infer();
-            return Common::outputs_to_dict(self.outputs(), request);
+            {
+                py::gil_scoped_release release;
+                request.infer();
+            }
+            // Request is not reused, so its output tensors can be passed to the user without copying
+            return Common::outputs_to_dict(self.outputs(), request, true);
         },
         py::arg("inputs"));
 
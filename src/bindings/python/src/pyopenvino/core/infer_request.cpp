@@ -58,16 +58,20 @@ void regclass_InferRequest(py::module m) {
 
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool shared_memory) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
-            // Call Infer function
-            self._start_time = Time::now();
-            self._request.infer();
-            self._end_time = Time::now();
-            return Common::outputs_to_dict(self._outputs, self._request);
+            // Call Infer function, GIL can be released - we are NOT working with Python objects in this block
+            {
+                py::gil_scoped_release release;
+                self._start_time = Time::now();
+                self._request.infer();
+                self._end_time = Time::now();
+            }
+            return Common::outputs_to_dict(self._outputs, self._request, shared_memory);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("shared_memory") = false);
 
     cls.def(
         "start_async",
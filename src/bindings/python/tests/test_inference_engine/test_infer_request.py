@@ -368,6 +368,40 @@ def test_get_results(device):
         assert np.array_equal(results[output], request.results[output])
 
 
+def test_get_results_shared_memory(device):
+    core = Core()
+    data = ops.parameter([10], np.float32)
+    model = Model(ops.relu(data), [data])
+    compiled = core.compile_model(model, device)
+    request = compiled.create_infer_request()
+    inputs = [np.random.normal(size=list(compiled.input().shape)).astype(np.float32)]
+    results = request.infer(inputs, shared_memory=True)
+    output_tensor = request.get_tensor(compiled.output())
+    assert np.shares_memory(results[compiled.output()], output_tensor.data)
+    assert np.array_equal(results[compiled.output()], np.maximum(inputs[0], 0))
+
+
+def test_infer_queue_start_async_batch(device):
+    jobs = 8
+    num_request = 4
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    infer_queue = AsyncInferQueue(exec_net, num_request)
+    jobs_done = [{"finished": False, "latency": 0} for _ in range(jobs)]
+
+    def callback(request, job_id):
+        jobs_done[job_id]["finished"] = True
+        jobs_done[job_id]["latency"] = request.latency
+
+    img = read_image()
+    infer_queue.set_callback(callback)
+    infer_queue.start_async_batch([{"data": img}] * jobs, list(range(jobs)))
+    infer_queue.wait_all()
+    assert all(job["finished"] for job in jobs_done)
+    assert all(job["latency"] > 0 for job in jobs_done)
+
+
 def test_results_async_infer(device):
     jobs = 8
     num_request = 4
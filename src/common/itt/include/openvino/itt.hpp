@@ -44,6 +44,8 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            bool traceStart(const char* path);
+            bool traceDump(const char* path);
         }
 /**
  * @endcond
@@ -65,6 +67,35 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn bool startTrace(const std::string& path)
+         * @ingroup ie_dev_profiling
+         * @brief Starts recording of tasks by the built-in collector, the same as the OPENVINO_TRACE_FILE
+         *        environment variable does. The tasks begun before are not recorded.
+         * @param path [in] The file the trace is written to at process exit
+         * @return false if OpenVINO is built without ITT or the collector records to another file
+         */
+        inline bool startTrace(const std::string& path)
+        {
+            return internal::traceStart(path.c_str());
+        }
+
+        /**
+         * @fn bool dumpTrace(const std::string& path)
+         * @ingroup ie_dev_profiling
+         * @brief Writes tasks recorded by the built-in collector to a file in Chrome trace format.
+         * @details The collector is enabled by the OPENVINO_TRACE_FILE environment variable or startTrace()
+         *          and keeps the last OPENVINO_TRACE_BUFFER_SIZE tasks per thread. Tasks of all the libraries
+         *          of the process are written. The trace can be opened with
+         *          chrome://tracing or Perfetto UI.
+         * @param path [in] The output file path
+         * @return false if the collector is disabled or the file can't be written
+         */
+        inline bool dumpTrace(const std::string& path)
+        {
+            return internal::traceDump(path.c_str());
+        }
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Built-in collector which records ITT tasks into per thread ring buffers
+ *        and writes them in Chrome trace (chrome://tracing, Perfetto) format.
+ * @details The itt library is linked statically into the runtime and into every plugin and frontend,
+ *          so the collector is not a part of it: it is implemented once in the OpenVINO runtime library
+ *          and the itt library only forwards tasks to it. All the libraries of a process record
+ *          into the same buffers and the trace is written to one file.
+ * @file chrome_trace.hpp
+ */
+
+#pragma once
+
+#include <string>
+
+#if defined(OPENVINO_STATIC_LIBRARY)
+#    define OPENVINO_TRACE_API
+#elif defined(_WIN32)
+#    ifdef IMPLEMENT_OPENVINO_API
+#        define OPENVINO_TRACE_API __declspec(dllexport)
+#    else
+#        define OPENVINO_TRACE_API __declspec(dllimport)
+#    endif
+#else
+#    define OPENVINO_TRACE_API __attribute__((visibility("default")))
+#endif
+
+namespace openvino {
+namespace itt {
+namespace internal {
+namespace trace {
+
+/**
+ * @brief Named annotation of the collector, domain_t and handle_t point to it.
+ *        Keeps the original ITT handle, so both the collector and ittnotify receive the same tasks.
+ */
+struct Name {
+    std::string name;
+    void* itt;
+};
+
+/**
+ * @brief Returns a unique domain annotation for the name, the same for all the libraries of the process
+ */
+OPENVINO_TRACE_API const Name* domain(const char* name, void* itt);
+
+/**
+ * @brief Returns a unique task annotation for the name, the same for all the libraries of the process
+ */
+OPENVINO_TRACE_API const Name* handle(const char* name, void* itt);
+
+/**
+ * @brief Begins a task of the current thread, does nothing if recording is not started
+ */
+OPENVINO_TRACE_API void taskBegin(const Name* domain, const Name* task);
+
+/**
+ * @brief Ends the last task of the current thread which was begun during recording
+ */
+OPENVINO_TRACE_API void taskEnd();
+
+OPENVINO_TRACE_API void threadName(const char* name);
+
+/**
+ * @brief Starts recording if it is not started yet, the trace is written to the path at process exit.
+ * @details Recording is started on the first use of the collector if the OPENVINO_TRACE_FILE
+ *          environment variable is set. The ring buffer capacity (in events per thread) is configured
+ *          by OPENVINO_TRACE_BUFFER_SIZE.
+ * @return false if recording was already started with another path
+ */
+OPENVINO_TRACE_API bool start(const char* path);
+
+/**
+ * @brief Writes the tasks recorded by all the threads of the process to the path
+ * @return false if recording is not started or the file can't be written
+ */
+OPENVINO_TRACE_API bool dump(const char* path);
+
+}  // namespace trace
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
@@ -7,6 +7,7 @@
 
 #ifdef ENABLE_PROFILING_ITT
 #include <ittnotify.h>
+#include <openvino/itt/chrome_trace.hpp>
 #endif
 
 namespace openvino {
@@ -23,31 +24,54 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+// domain_t and handle_t point to the names of the built-in collector which keep the original ITT handles,
+// so both backends receive the same tasks. The collector is a part of the runtime library,
+// so the names and the recorded tasks are shared by all the libraries of the process.
+using Name = trace::Name;
+
+static __itt_domain* ittDomain(domain_t d) {
+    return static_cast<__itt_domain*>(reinterpret_cast<const Name*>(d)->itt);
+}
+
 domain_t domain(char const* name) {
-    return reinterpret_cast<domain_t>(__itt_domain_create(name));
+    return reinterpret_cast<domain_t>(const_cast<Name*>(trace::domain(name, __itt_domain_create(name))));
 }
 
 handle_t handle(char const* name) {
-    return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    return reinterpret_cast<handle_t>(const_cast<Name*>(trace::handle(name, __itt_string_handle_create(name))));
 }
 
 void taskBegin(domain_t d, handle_t t) {
-    if (!callStackDepth() || call_stack_depth++ < callStackDepth())
-        __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth()) {
+        auto task = reinterpret_cast<const Name*>(t);
+        trace::taskBegin(reinterpret_cast<const Name*>(d), task);
+        __itt_task_begin(ittDomain(d),
                         __itt_null,
                         __itt_null,
-                        reinterpret_cast<__itt_string_handle*>(t));
+                        static_cast<__itt_string_handle*>(task->itt));
+    }
 }
 
 void taskEnd(domain_t d) {
-    if (!callStackDepth() || --call_stack_depth < callStackDepth())
-        __itt_task_end(reinterpret_cast<__itt_domain*>(d));
+    if (!callStackDepth() || --call_stack_depth < callStackDepth()) {
+        trace::taskEnd();
+        __itt_task_end(ittDomain(d));
+    }
 }
 
 void threadName(const char* name) {
+    trace::threadName(name);
     __itt_thread_set_name(name);
 }
 
+bool traceStart(const char* path) {
+    return trace::start(path);
+}
+
+bool traceDump(const char* path) {
+    return trace::dump(path);
+}
+
 #else
 
 domain_t domain(char const *) { return nullptr; }
@@ -60,6 +84,10 @@ void taskEnd(domain_t) { }
 
 void threadName(const char *) { }
 
+bool traceStart(const char *) { return false; }
+
+bool traceDump(const char *) { return false; }
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
@@ -32,4 +32,9 @@ class ngraph::pass::low_precision::MarkupCanBeQuantized : public ngraph::pass::F
 public:
     NGRAPH_RTTI_DECLARATION;
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
+
+    /**
+     * @brief Marks one operation, allows to combine the markup with other passes in one model traversal.
+     */
+    void markup(const std::shared_ptr<Node>& node);
 };
@@ -48,6 +48,11 @@ public:
     explicit MarkupPerTensorQuantization(const std::vector<OperationPerTensorQuantizationRestriction>& restrictions = {});
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
 
+    /**
+     * @brief Marks one operation, allows to combine the markup with other passes in one model traversal.
+     */
+    void markup(const std::shared_ptr<Node>& node);
+
 private:
     std::unordered_map<std::string, PerTensorQuantization> restrictionsByOperation;
 };
@@ -51,6 +51,11 @@ public:
     explicit MarkupPrecisions(const std::vector<OperationPrecisionRestriction>& restrictions = {});
     bool run_on_model(const std::shared_ptr<ngraph::Function>& m) override;
 
+    /**
+     * @brief Marks one operation, allows to combine the markup with other passes in one model traversal.
+     */
+    void markup(const std::shared_ptr<Node>& node);
+
 private:
     static bool isPrecisionPreserved(const std::shared_ptr<Node>& node);
     static bool isSupported(const std::shared_ptr<Node>& node);
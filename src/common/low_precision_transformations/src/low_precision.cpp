@@ -168,20 +168,52 @@ MarkupOptimizations::MarkupOptimizations(
     quantizationRestrictions(quantizationRestrictions) {}
 
 bool ngraph::pass::low_precision::MarkupOptimizations::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
-    ngraph::pass::Manager markup(get_pass_config());
-    markup.set_per_pass_validation(false);
-    markup.register_pass<low_precision::MarkupCanBeQuantized>();
-    if (!precisionRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPrecisions>(precisionRestrictions);
+    const auto passConfig = get_pass_config();
+
+    // Operation markups set attributes of the operation and its inputs only, so they are applied in one model
+    // traversal instead of a traversal per pass. The order of the markups for an operation is kept.
+    std::shared_ptr<low_precision::MarkupCanBeQuantized> markupCanBeQuantized;
+    if (!passConfig->is_disabled<low_precision::MarkupCanBeQuantized>()) {
+        markupCanBeQuantized = std::make_shared<low_precision::MarkupCanBeQuantized>();
+        markupCanBeQuantized->set_pass_config(passConfig);
+    }
+    std::shared_ptr<low_precision::MarkupPrecisions> markupPrecisions;
+    if (!precisionRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPrecisions>()) {
+        markupPrecisions = std::make_shared<low_precision::MarkupPrecisions>(precisionRestrictions);
+        markupPrecisions->set_pass_config(passConfig);
+    }
+    std::shared_ptr<low_precision::MarkupPerTensorQuantization> markupPerTensorQuantization;
+    if (!quantizationRestrictions.empty() && !passConfig->is_disabled<low_precision::MarkupPerTensorQuantization>()) {
+        markupPerTensorQuantization = std::make_shared<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+        markupPerTensorQuantization->set_pass_config(passConfig);
     }
-    if (!quantizationRestrictions.empty()) {
-        markup.register_pass<low_precision::MarkupPerTensorQuantization>(quantizationRestrictions);
+
+    bool hasAvgPool = false;
+    bool hasConcat = false;
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::LPT_LT, "MarkupOperations");
+        for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+            if (markupCanBeQuantized) {
+                markupCanBeQuantized->markup(node);
+            }
+            if (markupPrecisions) {
+                markupPrecisions->markup(node);
+            }
+            if (markupPerTensorQuantization) {
+                markupPerTensorQuantization->markup(node);
+            }
+            hasAvgPool = hasAvgPool || std::dynamic_pointer_cast<ngraph::opset1::AvgPool>(node) != nullptr;
+            hasConcat = hasConcat || std::dynamic_pointer_cast<ngraph::opset1::Concat>(node) != nullptr;
+        }
     }
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::AvgPool>(f)) {
+
+    ngraph::pass::Manager markup(passConfig);
+    markup.set_per_pass_validation(false);
+    if (hasAvgPool) {
         markup.register_pass<low_precision::MarkupAvgPoolPrecisionPreserved>();
     }
     markup.register_pass<low_precision::PropagatePrecisions>();
-    if (ngraph::op::util::has_op_with_type<ngraph::opset1::Concat>(f)) {
+    if (hasConcat) {
         markup.register_pass<low_precision::AlignQuantizationIntervals>();
         markup.register_pass<low_precision::AlignQuantizationParameters>();
     }
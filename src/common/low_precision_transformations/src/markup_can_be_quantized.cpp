@@ -19,6 +19,13 @@ using namespace ngraph;
 NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::MarkupCanBeQuantized, "MarkupCanBeQuantized", 0);
 
 bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        markup(node);
+    }
+    return true;
+}
+
+void ngraph::pass::low_precision::MarkupCanBeQuantized::markup(const std::shared_ptr<Node>& node) {
     auto setEmptyPrecisions = [](const std::shared_ptr<ngraph::Node>& node) {
         for (auto& input : node->inputs()) {
             auto& rt = input.get_rt_info();
@@ -28,35 +35,32 @@ bool ngraph::pass::low_precision::MarkupCanBeQuantized::run_on_model(const std::
         }
     };
 
-    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0 || transformation_callback(node)) {
-            continue;
-        }
+    if (node->get_input_size() == 0 || transformation_callback(node)) {
+        return;
+    }
 
-        if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
-            if (!ConvolutionTransformation::isQuantizedStatic(convolution)) {
-                setEmptyPrecisions(convolution);
-            }
-            continue;
+    if (const auto convolution = std::dynamic_pointer_cast<ngraph::opset1::Convolution>(node)) {
+        if (!ConvolutionTransformation::isQuantizedStatic(convolution)) {
+            setEmptyPrecisions(convolution);
         }
-        if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
-            if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData)) {
-                setEmptyPrecisions(convolutionBackpropData);
-            }
-            continue;
+        return;
+    }
+    if (const auto convolutionBackpropData = std::dynamic_pointer_cast<ngraph::opset1::ConvolutionBackpropData>(node)) {
+        if (!ConvolutionBackpropDataTransformation::isQuantizedStatic(convolutionBackpropData)) {
+            setEmptyPrecisions(convolutionBackpropData);
         }
-        if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
-            if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution)) {
-                setEmptyPrecisions(groupConvolution);
-            }
-            continue;
+        return;
+    }
+    if (const auto groupConvolution = std::dynamic_pointer_cast<ngraph::opset1::GroupConvolution>(node)) {
+        if (!GroupConvolutionTransformation::isQuantizedStatic(groupConvolution)) {
+            setEmptyPrecisions(groupConvolution);
         }
-        if (const auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(node)) {
-            if (!ConcatTransformation::isQuantizedStatic(concat)) {
-                setEmptyPrecisions(concat);
-            }
-            continue;
+        return;
+    }
+    if (const auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(node)) {
+        if (!ConcatTransformation::isQuantizedStatic(concat)) {
+            setEmptyPrecisions(concat);
         }
+        return;
     }
-    return true;
 }
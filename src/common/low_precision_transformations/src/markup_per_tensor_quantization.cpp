@@ -29,6 +29,13 @@ ngraph::pass::low_precision::MarkupPerTensorQuantization::MarkupPerTensorQuantiz
 }
 
 bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
+        markup(node);
+    }
+    return true;
+}
+
+void ngraph::pass::low_precision::MarkupPerTensorQuantization::markup(const std::shared_ptr<Node>& node) {
     auto setRestriction = [](const std::shared_ptr<Node>& node, const std::vector<size_t>& restrictedPorts) {
         auto createAttribute = [](Input<Node>& input){
             auto &rt = input.get_rt_info();
@@ -52,34 +59,31 @@ bool ngraph::pass::low_precision::MarkupPerTensorQuantization::run_on_model(cons
         }
     };
 
-    for (const std::shared_ptr<Node>& node : f->get_ordered_ops()) {
-        if (node->get_input_size() == 0) {
-            continue;
-        }
-
-        const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
-        if (typeIt == restrictionsByOperation.end()) {
-            continue;
-        }
+    if (node->get_input_size() == 0) {
+        return;
+    }
 
-        const auto& restriction = typeIt->second;
-        if (restriction.portsByVersion.empty()) {
-            continue;
-        }
+    const auto typeIt = restrictionsByOperation.find(node->get_type_info().name);
+    if (typeIt == restrictionsByOperation.end()) {
+        return;
+    }
 
-        if (restriction.versionIsRequired) {
-            const auto it2 = restriction.portsByVersion.find(node->get_type_info().version);
-            if (it2 == restriction.portsByVersion.end()) {
-                continue;
-            }
+    const auto& restriction = typeIt->second;
+    if (restriction.portsByVersion.empty()) {
+        return;
+    }
 
-            const std::vector<size_t>& restrictedPorts = it2->second;
-            setRestriction(node, restrictedPorts);
-        } else {
-            assert(restriction.portsByVersion.size() == 1ul);
-            const std::vector<size_t>& restrictedPorts = restriction.portsByVersion.begin()->second;
-            setRestriction(node, restrictedPorts);
+    if (restriction.versionIsRequired) {
+        const auto it2 = restriction.portsByVersion.find(node->get_type_info().version);
+        if (it2 == restriction.portsByVersion.end()) {
+            return;
         }
+
+        const std::vector<size_t>& restrictedPorts = it2->second;
+        setRestriction(node, restrictedPorts);
+    } else {
+        assert(restriction.portsByVersion.size() == 1ul);
+        const std::vector<size_t>& restrictedPorts = restriction.portsByVersion.begin()->second;
+        setRestriction(node, restrictedPorts);
     }
-    return true;
 }
@@ -0,0 +1,304 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_PROFILING_ITT
+
+#    include <atomic>
+#    include <chrono>
+#    include <cstdint>
+#    include <cstdlib>
+#    include <fstream>
+#    include <iomanip>
+#    include <memory>
+#    include <mutex>
+#    include <openvino/itt/chrome_trace.hpp>
+#    include <unordered_map>
+#    include <vector>
+
+#    ifdef _WIN32
+#        ifndef NOMINMAX
+#            define NOMINMAX
+#        endif
+#        include <windows.h>
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#        ifdef __linux__
+#            include <sys/syscall.h>
+#        endif
+#    endif
+
+namespace openvino {
+namespace itt {
+namespace internal {
+namespace trace {
+namespace {
+
+uint64_t processId() {
+#    ifdef _WIN32
+    return GetCurrentProcessId();
+#    else
+    return static_cast<uint64_t>(getpid());
+#    endif
+}
+
+// Ids of the operating system, so threads of all the libraries and processes are distinguished in the trace
+uint64_t threadId() {
+#    if defined(_WIN32)
+    return GetCurrentThreadId();
+#    elif defined(__linux__)
+    return static_cast<uint64_t>(syscall(SYS_gettid));
+#    elif defined(__APPLE__)
+    uint64_t tid = 0;
+    pthread_threadid_np(nullptr, &tid);
+    return tid;
+#    else
+    return reinterpret_cast<uint64_t>(pthread_self());
+#    endif
+}
+
+void writeEscaped(std::ostream& os, const std::string& str) {
+    os << '"';
+    for (char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                os << ' ';
+            else
+                os << c;
+        }
+    }
+    os << '"';
+}
+
+// Chrome trace expects timestamps in microseconds
+void writeTime(std::ostream& os, uint64_t ns) {
+    os << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+class Collector {
+public:
+    // The collector is never destroyed since tasks may be finished by threads which outlive static objects
+    static Collector& get() {
+        static Collector* collector = new Collector();
+        return *collector;
+    }
+
+    const Name* intern(bool isDomain, const char* name, void* itt) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& entry = (isDomain ? _domains : _handles)[name ? name : ""];
+        if (!entry)
+            entry.reset(new Name{name ? name : "", itt});
+        return entry.get();
+    }
+
+    bool start(const std::string& path) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_recording.load())
+            return path == _path;
+        _path = path;
+        const char* size = std::getenv("OPENVINO_TRACE_BUFFER_SIZE");
+        const size_t capacity = size ? std::strtoul(size, nullptr, 10) : 0;
+        _capacity = capacity ? capacity : 1 << 16;
+        std::atexit([] {
+            auto& collector = get();
+            collector.dump(collector.path());
+        });
+        _recording.store(true);
+        return true;
+    }
+
+    void taskBegin(const Name* domain, const Name* task) {
+        if (!_recording.load(std::memory_order_relaxed))
+            return;
+        buffer().stack.push_back({domain, task, now(), 0});
+    }
+
+    void taskEnd() {
+        if (!_recording.load(std::memory_order_relaxed))
+            return;
+        auto& buf = buffer();
+        if (buf.stack.empty())
+            return;
+        Event event = buf.stack.back();
+        buf.stack.pop_back();
+        event.end = now();
+
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        if (buf.events.size() < _capacity) {
+            buf.events.push_back(event);
+        } else {
+            buf.events[buf.next] = event;
+            buf.next = (buf.next + 1) % _capacity;
+        }
+    }
+
+    void threadName(const char* name) {
+        if (!_recording.load(std::memory_order_relaxed))
+            return;
+        auto& buf = buffer();
+        std::lock_guard<std::mutex> lock(buf.mutex);
+        buf.name = name ? name : "";
+    }
+
+    std::string path() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _path;
+    }
+
+    bool dump(const std::string& path) {
+        if (!_recording.load())
+            return false;
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            buffers = _buffers;
+        }
+
+        std::ofstream os(path);
+        if (!os.is_open())
+            return false;
+
+        os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&] {
+            if (!first)
+                os << ",\n";
+            first = false;
+        };
+
+        for (const auto& buf : buffers) {
+            std::lock_guard<std::mutex> lock(buf->mutex);
+            if (!buf->name.empty()) {
+                separator();
+                os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << _pid << ",\"tid\":" << buf->tid
+                   << ",\"args\":{\"name\":";
+                writeEscaped(os, buf->name);
+                os << "}}";
+            }
+            // events are stored in the order of completion, the oldest one is at 'next' once the ring is full
+            for (size_t i = 0; i < buf->events.size(); i++) {
+                const auto& event = buf->events[(buf->next + i) % buf->events.size()];
+                separator();
+                os << "{\"name\":";
+                writeEscaped(os, event.task->name);
+                os << ",\"cat\":";
+                writeEscaped(os, event.domain->name);
+                os << ",\"ph\":\"X\",\"pid\":" << _pid << ",\"tid\":" << buf->tid << ",\"ts\":";
+                writeTime(os, event.begin);
+                os << ",\"dur\":";
+                writeTime(os, event.end - event.begin);
+                os << "}";
+            }
+        }
+        os << "]}\n";
+        return os.good();
+    }
+
+private:
+    using Names = std::unordered_map<std::string, std::unique_ptr<Name>>;
+
+    struct Event {
+        const Name* domain;
+        const Name* task;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    struct ThreadBuffer {
+        explicit ThreadBuffer(uint64_t id) : tid(id) {}
+
+        const uint64_t tid;
+        // guards events, next and name, the owner thread is the only writer
+        std::mutex mutex;
+        std::vector<Event> events;
+        size_t next = 0;
+        std::string name;
+        // accessed by the owner thread only
+        std::vector<Event> stack;
+    };
+
+    Collector() : _pid(processId()), _start(std::chrono::steady_clock::now()) {
+        const char* path = std::getenv("OPENVINO_TRACE_FILE");
+        if (path && *path)
+            start(path);
+    }
+
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start)
+            .count();
+    }
+
+    ThreadBuffer& buffer() {
+        // The buffer is shared with the collector, so events of finished threads are kept till dump
+        static thread_local std::shared_ptr<ThreadBuffer> buffer;
+        if (!buffer) {
+            buffer = std::make_shared<ThreadBuffer>(threadId());
+            std::lock_guard<std::mutex> lock(_mutex);
+            _buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    const uint64_t _pid;
+    const std::chrono::steady_clock::time_point _start;
+    std::atomic<bool> _recording{false};
+    // set once before recording is started
+    std::string _path;
+    size_t _capacity = 0;
+
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+    Names _domains;
+    Names _handles;
+};
+
+}  // namespace
+
+const Name* domain(const char* name, void* itt) {
+    return Collector::get().intern(true, name, itt);
+}
+
+const Name* handle(const char* name, void* itt) {
+    return Collector::get().intern(false, name, itt);
+}
+
+void taskBegin(const Name* domain, const Name* task) {
+    Collector::get().taskBegin(domain, task);
+}
+
+void taskEnd() {
+    Collector::get().taskEnd();
+}
+
+void threadName(const char* name) {
+    Collector::get().threadName(name);
+}
+
+bool start(const char* path) {
+    return path && *path && Collector::get().start(path);
+}
+
+bool dump(const char* path) {
+    return path && Collector::get().dump(path);
+}
+
+}  // namespace trace
+}  // namespace internal
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_ITT
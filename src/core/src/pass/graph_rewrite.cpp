@@ -5,7 +5,9 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
@@ -86,6 +88,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
+    // Time spent in each MatcherPass is reported together with the pass manager profile
+    static const bool profile_enabled = ngraph::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    struct MatcherProfile {
+        std::chrono::steady_clock::duration time{0};
+        size_t applied = 0;
+    };
+    std::unordered_map<const MatcherPass*, MatcherProfile> matcher_profiles;
+
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
@@ -144,7 +154,16 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status;
+        if (profile_enabled) {
+            const auto start = std::chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto& profile = matcher_profiles[m_pass.get()];
+            profile.time += std::chrono::steady_clock::now() - start;
+            profile.applied += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -227,6 +246,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             }
         }
     }
+
+    if (profile_enabled) {
+        for (const auto& m_pass : m_matchers) {
+            const auto profile = matcher_profiles.find(m_pass.get());
+            if (profile == matcher_profiles.end())
+                continue;
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(profile->second.time).count();
+            std::cout << "  " << std::setw(7) << ms << "ms " << m_pass->get_name() << " (applied "
+                      << profile->second.applied << " times)\n";
+        }
+    }
     return rewritten;
 }
 
@@ -4,13 +4,18 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <ngraph/variant.hpp>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "itt.hpp"
 #include "ngraph/ops.hpp"
@@ -60,63 +65,192 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    auto seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// XXH64 hash function, fast and has good distribution, so equal hashes almost always mean equal data
+namespace xxh64 {
+constexpr uint64_t prime1 = 11400714785074694791ULL;
+constexpr uint64_t prime2 = 14029467366897019727ULL;
+constexpr uint64_t prime3 = 1609587929392839161ULL;
+constexpr uint64_t prime4 = 9650029242287828579ULL;
+constexpr uint64_t prime5 = 2870177450012600261ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+    acc ^= round(0, value);
+    return acc * prime1 + prime4;
+}
+
+uint64_t hash(const char* p, size_t size, uint64_t seed) {
+    const char* const end = p + size;
+    uint64_t h;
+    if (size >= 32) {
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        const char* const limit = end - 32;
+        do {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= round(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        h ^= static_cast<uint64_t>(v) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<uint64_t>(static_cast<uint8_t>(*p)) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+}  // namespace xxh64
+
+// Big constants are split into fixed size chunks which are hashed in parallel. The result depends on the chunk
+// size only, so it is the same for any number of threads.
+uint64_t hash_constant(const char* data, size_t size) {
+    constexpr size_t chunk_size = 4 * 1024 * 1024;
+    if (size <= chunk_size) {
+        return xxh64::hash(data, size, 0);
+    }
+
+    const size_t chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<uint64_t> chunk_hashes(chunks);
+    std::atomic<size_t> next_chunk{0};
+    auto hash_chunks = [&] {
+        for (size_t i = next_chunk++; i < chunks; i = next_chunk++) {
+            const size_t offset = i * chunk_size;
+            chunk_hashes[i] = xxh64::hash(data + offset, std::min(chunk_size, size - offset), i);
+        }
+    };
+    const size_t threads_count = std::min<size_t>(chunks, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count - 1);
+    for (size_t i = 1; i < threads_count; i++) {
+        threads.emplace_back(hash_chunks);
+    }
+    hash_chunks();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return xxh64::hash(reinterpret_cast<const char*>(chunk_hashes.data()),
+                       chunk_hashes.size() * sizeof(uint64_t),
+                       static_cast<uint64_t>(size));
 }
 
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
+    using HashValue = uint64_t;
+    struct WrittenConstant {
+        FilePosition offset;
+        void const* ptr;
+        size_t size;
+    };
+    using ConstWritePositions = std::unordered_map<HashValue, WrittenConstant>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data),
-          m_enable_compression(enable_compression),
-          m_blob_offset(bin_data.tellp()) {}
+          m_enable_compression(enable_compression) {
+        m_buffer.reserve(buffer_size);
+    }
+
+    ConstantWriter(const ConstantWriter&) = delete;
+    ConstantWriter& operator=(const ConstantWriter&) = delete;
+
+    ~ConstantWriter() {
+        flush();
+    }
 
     FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
+            return append(ptr, size);
         }
-        // This hash is weak (but efficient) and must be replace with some other
-        // more stable hash algorithm. For example current hash algorithms gives
-        // the same hash for {2, 2} and {0, 128} arrays. So we have to compare
-        // values when finding a match in hash map.
-        const HashValue hash = hash_combine(ptr, size);
+        // Data is compared as well, so a hash collision can't make different constants share data in bin file
+        const HashValue hash = hash_constant(ptr, size);
         const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions) &&
-            memcmp(static_cast<void const*>(ptr), found->second.second, size) == 0) {
-            return found->second.first;
+        if (found != end(m_hash_to_file_positions) && found->second.size == size &&
+            memcmp(static_cast<void const*>(ptr), found->second.ptr, size) == 0) {
+            return found->second.offset;
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
-
+        const auto offset = append(ptr, size);
+        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr), size}});
         return offset;
     }
 
+    /**
+     * @brief Writes buffered small constants to the output stream
+     */
+    void flush() {
+        if (!m_buffer.empty()) {
+            m_binary_output.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
 private:
+    // Small constants are gathered to big sequential writes, big constants are written directly
+    static constexpr size_t buffer_size = 1024 * 1024;
+
+    FilePosition append(const char* ptr, size_t size) {
+        const auto offset = m_written;
+        if (m_buffer.size() + size > buffer_size) {
+            flush();
+        }
+        if (size >= buffer_size) {
+            m_binary_output.write(ptr, size);
+        } else {
+            m_buffer.insert(m_buffer.end(), ptr, ptr + size);
+        }
+        m_written += static_cast<FilePosition>(size);
+        return offset;
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
-    FilePosition m_blob_offset;  // blob offset inside output stream
+    std::vector<char> m_buffer;
+    FilePosition m_written = 0;  // offset of the next constant from the beginning of the blob
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -1003,6 +1137,7 @@ void serializeFunc(std::ostream& xml_file,
     ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
+    constant_write_handler.flush();
 
     xml_doc.save(xml_file);
     xml_file.flush();
@@ -1136,6 +1271,7 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ngraph::Function>
     XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler, version);
     std::shared_ptr<ov::Model> fun = f;
     visitor.on_attribute(name, fun);
+    constant_write_handler.flush();
 
     // IR
     hdr.model_offset = m_stream.tellp();
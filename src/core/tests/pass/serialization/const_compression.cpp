@@ -5,9 +5,11 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <set>
 
 #include "openvino/opsets/opset8.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "read_ir.hpp"
 #include "util/test_common.hpp"
 
 class SerializatioConstantCompressionTest : public ov::test::TestsCommon {
@@ -207,3 +209,62 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, IdenticalBigConstants) {
+    constexpr int unique_const_count = 1;
+    // bigger than the chunk hashed by a single thread
+    const ov::Shape shape{3, 1024, 1024};
+
+    std::vector<float> values(ov::shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<float>(i % 1000);
+    }
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{A, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ov::shape_size(shape) * sizeof(float));
+}
+
+TEST_F(SerializatioConstantCompressionTest, NonIdenticalBigConstantsMixedWithSmall) {
+    const ov::Shape shape{3, 1024, 1024};
+    const ov::Shape small_shape{2, 2};
+
+    std::vector<float> values(ov::shape_size(shape), 1.0f);
+    auto A = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    values.back() = 2.0f;
+    auto B = ov::opset8::Constant::create(ov::element::f32, shape, values);
+    // weak hashes used to give the same value for these constants
+    auto C = ov::opset8::Constant::create(ov::element::i64, small_shape, {2, 2, 0, 0});
+    auto D = ov::opset8::Constant::create(ov::element::i64, small_shape, {0, 128, 0, 0});
+
+    auto ngraph_a = std::make_shared<ov::Model>(ov::NodeVector{C, A, D, B}, ov::ParameterVector{});
+
+    ov::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_model(ngraph_a);
+
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) ==
+                2 * ov::shape_size(shape) * sizeof(float) + 2 * ov::shape_size(small_shape) * sizeof(int64_t));
+
+    // constants are read back from the offsets stored in xml
+    auto model = ov::test::readModel(m_out_xml_path_1, m_out_bin_path_1);
+    std::set<std::vector<int64_t>> small_values;
+    std::set<float> big_last_values;
+    for (const auto& result : model->get_results()) {
+        auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(result->get_input_node_shared_ptr(0));
+        ASSERT_NE(nullptr, constant);
+        if (constant->get_element_type() == ov::element::i64) {
+            small_values.insert(constant->cast_vector<int64_t>());
+        } else {
+            big_last_values.insert(constant->cast_vector<float>().back());
+        }
+    }
+    EXPECT_EQ(std::set<std::vector<int64_t>>({{2, 2, 0, 0}, {0, 128, 0, 0}}), small_values);
+    EXPECT_EQ(std::set<float>({1.0f, 2.0f}), big_last_values);
+}
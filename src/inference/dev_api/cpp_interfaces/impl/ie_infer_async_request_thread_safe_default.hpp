@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
-#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,11 +42,125 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     enum InferState { Idle, Busy, Canceled, Stop };
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     IInferRequestInternal::Ptr _syncRequest;
 
+    /**
+     * @brief Completion state reused by all pipelines started by the request.
+     * Pipelines are numbered by generations, the last stage publishes its generation as completed.
+     * It is shared with the last stage task, so the request can be destroyed as soon as completion is observed.
+     */
+    struct CompletionState {
+        bool IsCompleted(const std::uint64_t generation) const noexcept {
+            return _completed.load() >= generation;
+        }
+
+        void Complete(const std::uint64_t generation, const std::exception_ptr& exception) {
+            if (nullptr != exception) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _exception = exception;
+                _failed.store(generation);
+            }
+            auto completed = _completed.load();
+            while (completed < generation && !_completed.compare_exchange_weak(completed, generation)) {
+            }
+            // waiters are registered before they check completion, so either they observe the new generation
+            // or notification is sent under the mutex after they start waiting
+            if (_waiters.load() > 0) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _condition.notify_all();
+            }
+        }
+
+        bool WaitFor(const std::uint64_t generation, const int64_t millis_timeout) {
+            _waiters.fetch_add(1);
+            bool completed = true;
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                auto isCompleted = [&] {
+                    return IsCompleted(generation);
+                };
+                if (millis_timeout == InferRequest::WaitMode::RESULT_READY) {
+                    _condition.wait(lock, isCompleted);
+                } else {
+                    completed = _condition.wait_for(lock, std::chrono::milliseconds{millis_timeout}, isCompleted);
+                }
+            }
+            _waiters.fetch_sub(1);
+            return completed;
+        }
+
+        /**
+         * @brief Last stages touch the request after the callback, while a pipeline restarted from the callback
+         * may already complete a newer generation, so the request waits for all of them before destruction
+         */
+        void EnterLastStage() noexcept {
+            _lastStages.fetch_add(1);
+        }
+
+        // must be the last access to the request by the last stage
+        void LeaveLastStage() {
+            if (_lastStages.fetch_sub(1) == 1 && _waiters.load() > 0) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _condition.notify_all();
+            }
+        }
+
+        /**
+         * @brief A start is in progress from the check of the request state till the generation is published,
+         * so a stopped request waits for it to know the final generation
+         */
+        void EnterStart() noexcept {
+            _starts.fetch_add(1);
+        }
+
+        std::uint64_t LeaveStart(const bool started) {
+            const auto generation = started ? _started.fetch_add(1) + 1 : 0;
+            if (_starts.fetch_sub(1) == 1 && _waiters.load() > 0) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _condition.notify_all();
+            }
+            return generation;
+        }
+
+        // must be called after the request state is switched to stop, so no new start can be entered
+        void WaitForStop() {
+            _waiters.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _condition.wait(lock, [&] {
+                    return 0 == _starts.load() && IsCompleted(_started.load()) && 0 == _lastStages.load();
+                });
+            }
+            _waiters.fetch_sub(1);
+        }
+
+        void RethrowIfFailed(const std::uint64_t generation) {
+            if (_failed.load() == generation) {
+                std::exception_ptr exception;
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    if (_failed.load() == generation) {
+                        exception = _exception;
+                    }
+                }
+                if (nullptr != exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+
+        std::atomic<std::uint64_t> _started{0};
+        std::atomic<std::uint64_t> _completed{0};
+        std::atomic<std::uint64_t> _failed{0};
+        std::atomic<std::size_t> _waiters{0};
+        std::atomic<std::size_t> _lastStages{0};
+        std::atomic<std::size_t> _starts{0};
+        std::exception_ptr _exception;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+    };
+
     friend struct DisableCallbackGuard;
     struct DisableCallbackGuard {
         explicit DisableCallbackGuard(AsyncInferRequestThreadSafeDefault* this_) : _this{this_} {
@@ -71,43 +188,32 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
         InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            switch (_state) {
+        _completion->EnterStart();
+        if (!_state.compare_exchange_strong(state, InferState::Busy)) {
+            _completion->LeaveStart(false);
+            switch (state) {
             case InferState::Busy:
                 IE_THROW(RequestBusy);
             case InferState::Canceled:
                 IE_THROW(InferCancelled);
-            case InferState::Idle: {
-                _futures.erase(std::remove_if(std::begin(_futures),
-                                              std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds{0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
-            } break;
-            case InferState::Stop:
-                break;
+            default:
+                return;
             }
-            _state = InferState::Busy;
         }
-        if (state != InferState::Stop) {
-            try {
-                f();
-            } catch (...) {
-                _promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
-                throw;
-            }
+        const auto generation = _completion->LeaveStart(true);
+        try {
+            f();
+        } catch (...) {
+            _completion->Complete(generation, std::current_exception());
+            SetIdle();
+            throw;
+        }
+    }
+
+    void SetIdle() noexcept {
+        auto state = _state.load();
+        while ((state == InferState::Busy || state == InferState::Canceled) &&
+               !_state.compare_exchange_weak(state, InferState::Idle)) {
         }
     }
 
@@ -116,8 +222,7 @@ protected:
      * @brief Throws exception if inference request is busy or canceled
      */
     void CheckState() const {
-        std::lock_guard<std::mutex> lock{_mutex};
-        switch (_state) {
+        switch (_state.load()) {
         case InferState::Busy:
             IE_THROW(RequestBusy);
         case InferState::Canceled:
@@ -182,37 +287,30 @@ public:
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just wait for completion of the last started pipeline
+        const auto generation = _completion->_started.load();
+        if (0 == generation) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
-        switch (millis_timeout) {
-        case InferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case InferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds{0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds{millis_timeout});
-        } break;
+        if (!_completion->IsCompleted(generation)) {
+            if (millis_timeout == InferRequest::WaitMode::STATUS_ONLY ||
+                !_completion->WaitFor(generation, millis_timeout)) {
+                return StatusCode::RESULT_NOT_READY;
+            }
         }
 
-        if (std::future_status::ready == status) {
-            future.get();
-            return StatusCode::OK;
-        } else {
-            return StatusCode::RESULT_NOT_READY;
-        }
+        _completion->RethrowIfFailed(generation);
+        return StatusCode::OK;
+    }
+
+    /**
+     * @brief Checks whether the last started pipeline is completed. Does not block and does not take locks,
+     *        so event loop based servers can poll requests instead of setting callbacks.
+     * @return `true` if the request was not started or the last started pipeline is completed
+     */
+    bool IsReady() const noexcept {
+        return _completion->IsCompleted(_completion->_started.load());
     }
 
     void StartAsync() override {
@@ -279,17 +377,14 @@ public:
     }
 
     void ThrowIfCanceled() const {
-        std::lock_guard<std::mutex> lock{_mutex};
-        if (_state == InferState::Canceled) {
+        if (_state.load(std::memory_order_relaxed) == InferState::Canceled) {
             IE_THROW(InferCancelled);
         }
     }
 
     void Cancel() override {
-        std::lock_guard<std::mutex> lock{_mutex};
-        if (_state == InferState::Busy) {
-            _state = InferState::Canceled;
-        }
+        InferState state = InferState::Busy;
+        _state.compare_exchange_strong(state, InferState::Canceled);
     }
 
     void setModelInputsOutputs(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
@@ -310,9 +405,8 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. Pipeline bounds and the callback executor are stored in the
+     * request, so stage tasks capture only the request and the stage and do not allocate memory.
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -322,7 +416,10 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _itEndStage = itEndStage;
+        _stageCallbackExecutor = std::move(callbackExecutor);
+        _stageException = nullptr;
+        firstStageExecutor->run(MakeNextStageTask(itBeginStage));
     }
 
     /**
@@ -331,23 +428,13 @@ protected:
      * pipeline tasks
      */
     void StopAndWait() {
-        Futures futures;
-        InferState state = InferState::Idle;
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
-            state = _state;
-            if (state != InferState::Stop) {
+        if (_state.exchange(InferState::Stop) != InferState::Stop) {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
                 _callback = {};
-                _state = InferState::Stop;
-                futures = std::move(_futures);
-            }
-        }
-        if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
             }
+            // no pipeline can be started anymore, the one being started is waited as well
+            _completion->WaitForStop();
         }
     }
 
@@ -383,78 +470,83 @@ protected:
 private:
     /**
      * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * The task captures only the request and the stage iterator, so it fits into the small buffer of the @ref Task
+     * and is not allocated on the heap. On last stage or if the exception is raised from `_pipeline` task
+     * the last stage task is called or passed to callback executor if it is presented.
      * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage,
-                           const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-                std::exception_ptr currentException = nullptr;
-                auto& thisStage = *itStage;
-                auto itNextStage = itStage + 1;
-                try {
-                    auto& stageTask = std::get<Stage_e::task>(thisStage);
-                    IE_ASSERT(nullptr != stageTask);
-                    stageTask();
-                    if (itEndStage != itNextStage) {
-                        auto& nextStage = *itNextStage;
-                        auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                        IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                    }
-                } catch (...) {
-                    currentException = std::current_exception();
-                }
+    Task MakeNextStageTask(const Pipeline::iterator itStage) {
+        return [this, itStage] {
+            RunStage(itStage);
+        };
+    }
 
-                if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
-                        auto promise = std::move(_promise);
-                        Callback callback;
-                        {
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            _state = InferState::Idle;
-                            std::swap(callback, _callback);
-                        }
-                        if (callback) {
-                            try {
-                                callback(currentException);
-                            } catch (...) {
-                                currentException = std::current_exception();
-                            }
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            if (!_callback) {
-                                std::swap(callback, _callback);
-                            }
-                        }
-                        if (nullptr == currentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(currentException);
-                        }
-                    };
-
-                    if (nullptr == callbackExecutor) {
-                        lastStageTask();
-                    } else {
-                        callbackExecutor->run(std::move(lastStageTask));
-                    }
-                }
-            },
-            std::move(callbackExecutor));
+    void RunStage(const Pipeline::iterator itStage) {
+        auto itNextStage = itStage + 1;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (_itEndStage != itNextStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                // the request must not be touched after the next stage is started
+                nextStageExecutor->run(MakeNextStageTask(itNextStage));
+                return;
+            }
+        } catch (...) {
+            _stageException = std::current_exception();
+        }
+
+        auto callbackExecutor = _stageCallbackExecutor;
+        if (nullptr == callbackExecutor) {
+            RunLastStage();
+        } else {
+            callbackExecutor->run([this] {
+                RunLastStage();
+            });
+        }
+    }
+
+    /**
+     * @brief The last stage calls the callback, if it is presented, and forwards completion or exception
+     * to the completion state.
+     */
+    void RunLastStage() {
+        // new pipeline can not be started until the state is switched to idle below
+        const auto generation = _completion->_started.load();
+        auto completion = _completion;
+        completion->EnterLastStage();
+        auto currentException = std::move(_stageException);
+        _stageException = nullptr;
+        Callback callback;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            SetIdle();
+            std::swap(callback, _callback);
+        }
+        if (callback) {
+            try {
+                callback(currentException);
+            } catch (...) {
+                currentException = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (!_callback) {
+                std::swap(callback, _callback);
+            }
+        }
+        // waiters of the result may go on, but the request is destroyed only after all last stages are left
+        completion->Complete(generation, currentException);
+        completion->LeaveLastStage();
     }
 
-    std::promise<void> _promise;
     mutable std::mutex _mutex;
-    Futures _futures;
-    InferState _state = InferState::Idle;
+    std::atomic<InferState> _state{InferState::Idle};
+    std::shared_ptr<CompletionState> _completion = std::make_shared<CompletionState>();
+    Pipeline::iterator _itEndStage;
+    ITaskExecutor::Ptr _stageCallbackExecutor;
+    std::exception_ptr _stageException;
 };
 }  // namespace InferenceEngine
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() and GetMetric() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name)              METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of an executable network to get per node execution time histograms, number of prepareParams calls
+ * and runtime cache misses as a JSON string. Counters are accumulated only if PERF_COUNT is enabled and can be
+ * retrieved while the network is running.
+ */
+DECLARE_CPU_METRIC_KEY(NODES_PROFILING, std::string);
+
+/**
+ * @brief Metric of an executable network to get the number of passes over memory per inference eliminated
+ * by merging chains of Convert, Reorder and Transpose nodes during the graph optimization
+ */
+DECLARE_CPU_METRIC_KEY(ELIMINATED_DATA_PASSES, unsigned int);
+
+/**
+ * @brief Metric of an executable network to get the memory allocated by the CPU plugin as a JSON string:
+ * currently allocated bytes, peak bytes and number of allocations per category (weights, activations and
+ * scratchpad - internal buffers of nodes) and bytes kept in the memory pool
+ */
+DECLARE_CPU_METRIC_KEY(MEMORY_STATISTICS, std::string);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name)           InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name)   DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key defines how the memory of weights, activations and internal buffers of nodes is allocated:
+ * • CPU_MEMORY_ALLOCATOR_DEFAULT    - aligned heap allocation
+ * • CPU_MEMORY_ALLOCATOR_HUGE_PAGES - buffers from 1 MB are placed on 2 MB pages (reserved huge pages if available,
+ *                                     transparent huge pages otherwise) and bound to the NUMA node of the stream.
+ *                                     Supported on Linux only, the default allocation is used on other platforms.
+ * The default value is CPU_MEMORY_ALLOCATOR_DEFAULT.
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_ALLOCATOR);
+DECLARE_CPU_CONFIG_VALUE(MEMORY_ALLOCATOR_DEFAULT);
+DECLARE_CPU_CONFIG_VALUE(MEMORY_ALLOCATOR_HUGE_PAGES);
+
+/**
+ * @brief The key enables (YES) keeping released buffers to reuse them for allocations of the same size,
+ * e.g. on reallocations of dynamic shapes. The buffers are freed with the executable network. The default value is NO.
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_POOL);
+
+}  // namespace CPUConfigParams
+
+}  // namespace InferenceEngine
@@ -219,6 +219,21 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get statistics of the models cache enabled by CONFIG_KEY(CACHE_DIR).
+ *
+ * The metric is requested from Core with an empty device name. Keys of the map:
+ * "hits" and "misses" - number of networks imported from cache and compiled because of missing / invalid entries,
+ * "import_time_us" and "compile_time_us" - total time spent to import cached networks and to compile and export
+ * networks to cache, "size_bytes" - total size of cached blobs, "evictions" - number of blobs removed to fit into
+ * CONFIG_KEY(CACHE_MAX_SIZE).
+ *
+ * @code
+ * auto stats = ie.GetMetric("", METRIC_KEY(CACHE_STATISTICS)).as<std::map<std::string, uint64_t>>();
+ * @endcode
+ */
+DECLARE_METRIC_KEY(CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -430,6 +445,34 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key limits the total size in bytes of blobs stored in CONFIG_KEY(CACHE_DIR)
+ *
+ * When the limit is exceeded, least recently used blobs are removed from the cache directory. Blobs being written
+ * by other processes are accounted too, temporary files left by crashed processes are removed.
+ * Default value is "0" which means no limit. The key is applied to the Core only:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_MAX_SIZE), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
+/**
+ * @brief This key enables sharing of compiled networks between identical LoadNetwork calls of the same Core
+ *
+ * If the network (or the model file), the device and the compilation config match a network loaded earlier
+ * which is still alive, the existing executable network is returned instead of compiling a new one, so
+ * weights and compiled kernels are kept in memory once. Executable networks returned this way are the same object,
+ * e.g. SetConfig called for one of them is visible through the others.
+ * Networks loaded with a remote context are not shared. Default value is CONFIG_VALUE(NO).
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(SHARE_COMPILED_MODELS), CONFIG_VALUE(YES)}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(SHARE_COMPILED_MODELS);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -0,0 +1,400 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+#include <streambuf>
+#include <utility>
+#include <vector>
+
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <signal.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    include <utime.h>
+#else
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#    include <process.h>
+#    include <sys/utime.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+const char blobExtension[] = ".blob";
+const char tempExtension[] = ".tmp";
+// a write of a blob never takes that long, so a temporary file is stale even if its process id is reused
+constexpr int64_t staleTempFileAge = 24 * 60 * 60;
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() > suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * @brief Read-only mapping of a whole file. Stays empty if the file can't be mapped.
+ */
+class MappedFile {
+    char* m_data = nullptr;
+    size_t m_size = 0;
+
+public:
+    explicit MappedFile(const std::string& path) {
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+        struct stat sb = {};
+        if (fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            void* data = mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_data = static_cast<char*>(data);
+                m_size = static_cast<size_t>(sb.st_size);
+            }
+        }
+        // the mapping holds its own reference to the file
+        close(fd);
+#else
+        HANDLE file = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size = {};
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                if (data != nullptr) {
+                    m_data = static_cast<char*>(data);
+                    m_size = static_cast<size_t>(size.QuadPart);
+                }
+                // the view holds its own reference to the mapping
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+        if (m_data == nullptr)
+            return;
+#ifndef _WIN32
+        munmap(m_data, m_size);
+#else
+        UnmapViewOfFile(m_data);
+#endif
+    }
+
+    char* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+};
+
+/**
+ * @brief Read-only seekable stream buffer over a memory region, no data is copied
+ */
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(char* data, size_t size) {
+        setg(data, data, data + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        const off_type position = (base - eback()) + off;
+        if (position < 0 || position > egptr() - eback())
+            return pos_type(off_type(-1));
+        setg(eback(), eback() + position, egptr());
+        return pos_type(position);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    std::streamsize showmanyc() override {
+        return egptr() - gptr();
+    }
+};
+
+std::string makeTempSuffix() {
+    static std::atomic<uint64_t> counter{0};
+#ifndef _WIN32
+    const auto pid = getpid();
+#else
+    const auto pid = _getpid();
+#endif
+    return "." + std::to_string(pid) + "." + std::to_string(counter++) + tempExtension;
+}
+
+/**
+ * @brief Parses a name of a temporary file created with makeTempSuffix, <id>.blob.<pid>.<n>.tmp
+ * @return false if the name has another format
+ */
+bool parseTempFileName(const std::string& name, std::string& id, int64_t& pid) {
+    const std::string extension = tempExtension;
+    if (!endsWith(name, extension))
+        return false;
+    const auto counterPos = name.rfind('.', name.size() - extension.size() - 1);
+    if (counterPos == std::string::npos || counterPos == 0)
+        return false;
+    const auto pidPos = name.rfind('.', counterPos - 1);
+    if (pidPos == std::string::npos)
+        return false;
+    const auto pidStr = name.substr(pidPos + 1, counterPos - pidPos - 1);
+    const auto blobName = name.substr(0, pidPos);
+    if (pidStr.empty() || pidStr.size() > 18 || pidStr.find_first_not_of("0123456789") != std::string::npos ||
+        !endsWith(blobName, blobExtension))
+        return false;
+    pid = std::stoll(pidStr);
+    id = blobName.substr(0, blobName.size() - std::string(blobExtension).size());
+    return true;
+}
+
+bool isProcessAlive(int64_t pid) {
+#ifndef _WIN32
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#else
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, static_cast<DWORD>(pid));
+    if (process == nullptr)
+        return GetLastError() == ERROR_ACCESS_DENIED;
+    DWORD exitCode = 0;
+    const bool alive = GetExitCodeProcess(process, &exitCode) && exitCode == STILL_ACTIVE;
+    CloseHandle(process);
+    return alive;
+#endif
+}
+
+/**
+ * @brief Sets the modification time of the file to the current time, so other processes see the last use of a blob
+ */
+void touchFile(const std::string& path) {
+#ifndef _WIN32
+    utime(path.c_str(), nullptr);
+#else
+    _utime(path.c_str(), nullptr);
+#endif
+}
+
+/**
+ * @brief Replaces the destination file, readers see either the old or the new content
+ */
+bool renameFile(const std::string& from, const std::string& to) {
+#ifndef _WIN32
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#else
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#endif
+}
+
+bool getFileInfo(const std::string& path, uint64_t& size, int64_t& modified) {
+#ifndef _WIN32
+    struct stat sb = {};
+    if (stat(path.c_str(), &sb) != 0)
+        return false;
+#else
+    struct _stat64 sb = {};
+    if (_stat64(path.c_str(), &sb) != 0)
+        return false;
+#endif
+    size = static_cast<uint64_t>(sb.st_size);
+    modified = static_cast<int64_t>(sb.st_mtime);
+    return true;
+}
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize)
+    : m_cachePath(std::move(cachePath)),
+      m_maxSize(maxSize) {
+    scanCacheDir();
+    evict();
+}
+
+void FileStorageCacheManager::scanCacheDir() {
+    struct FoundEntry {
+        std::string id;
+        uint64_t size;
+        int64_t modified;
+    };
+    std::vector<FoundEntry> found;
+    const std::string extension = blobExtension;
+    const auto now = static_cast<int64_t>(std::time(nullptr));
+    try {
+        ov::util::iterate_files(
+            m_cachePath,
+            [&](const std::string& file, bool is_dir) {
+                if (is_dir)
+                    return;
+                const auto name = ov::util::get_file_name(file);
+                FoundEntry entry;
+                int64_t pid = 0;
+                const bool isTemp = !endsWith(name, extension);
+                if (!isTemp) {
+                    entry.id = name.substr(0, name.size() - extension.size());
+                } else if (!parseTempFileName(name, entry.id, pid)) {
+                    return;
+                }
+                if (!getFileInfo(file, entry.size, entry.modified))
+                    return;
+                if (isTemp && (!isProcessAlive(pid) || now - entry.modified > staleTempFileAge)) {
+                    // left by a process which crashed during a write
+                    std::remove(file.c_str());
+                    return;
+                }
+                // a blob being written by another process takes its place in the cache soon
+                found.push_back(std::move(entry));
+            },
+            false);
+    } catch (...) {
+        // cache directory is not readable, entries are tracked starting from the first write
+    }
+
+    // the last modification time is the best guess of the last use across processes
+    std::sort(found.begin(), found.end(), [](const FoundEntry& a, const FoundEntry& b) {
+        return a.modified < b.modified;
+    });
+    std::unordered_map<std::string, uint64_t> sizes;
+    for (const auto& entry : found) {
+        // the blob and the files which replace it take the space of the biggest one
+        auto& size = sizes[entry.id];
+        size = std::max(size, entry.size);
+        touchEntry(entry.id, size);
+    }
+}
+
+void FileStorageCacheManager::touchEntry(const std::string& id, uint64_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        m_lru.push_front(id);
+        it = m_entries.emplace(id, Entry{}).first;
+    } else {
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lruPosition);
+        m_totalSize -= it->second.size;
+    }
+    it->second.size = size;
+    it->second.lruPosition = m_lru.begin();
+    m_totalSize += size;
+}
+
+void FileStorageCacheManager::forgetEntry(const std::string& id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(id);
+    if (it == m_entries.end())
+        return;
+    m_totalSize -= it->second.size;
+    m_lru.erase(it->second.lruPosition);
+    m_entries.erase(it);
+}
+
+void FileStorageCacheManager::evict() {
+    if (m_maxSize == 0)
+        return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the most recently used entry is kept even if it alone exceeds the limit
+    while (m_totalSize > m_maxSize && m_lru.size() > 1) {
+        const auto id = m_lru.back();
+        auto it = m_entries.find(id);
+        // removal may fail if the blob is still opened on Windows, it's evicted from accounting anyway
+        std::remove(getBlobFile(id).c_str());
+        m_totalSize -= it->second.size;
+        m_entries.erase(it);
+        m_lru.pop_back();
+        m_evictions++;
+    }
+}
+
+uint64_t FileStorageCacheManager::getCacheSize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_totalSize;
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tempFileName = blobFileName + makeTempSuffix();
+    bool written = false;
+    try {
+        std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+        writer(stream);
+        stream.close();
+        written = !stream.fail();
+    } catch (...) {
+        std::remove(tempFileName.c_str());
+        throw;
+    }
+
+    uint64_t size = 0;
+    int64_t modified = 0;
+    if (!written || !renameFile(tempFileName, blobFileName) || !getFileInfo(blobFileName, size, modified)) {
+        // network is not cached, same as when the cache directory is not writable
+        std::remove(tempFileName.c_str());
+        return;
+    }
+    touchEntry(id, size);
+    evict();
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName)) {
+        forgetEntry(id);
+        return;
+    }
+
+    // the modification time orders entries by the last use for the cache managers of other processes
+    touchFile(blobFileName);
+    MappedFile mapped(blobFileName);
+    if (mapped.data() != nullptr) {
+        touchEntry(id, mapped.size());
+        MemoryStreamBuf buffer(mapped.data(), mapped.size());
+        std::istream stream(&buffer);
+        reader(stream);
+    } else {
+        uint64_t size = 0;
+        int64_t modified = 0;
+        if (getFileInfo(blobFileName, size, modified))
+            touchEntry(id, size);
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+    forgetEntry(id);
+}
+
+}  // namespace InferenceEngine
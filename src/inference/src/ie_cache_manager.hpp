@@ -9,10 +9,15 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "file_utils.h"
 #include "ie_api.h"
@@ -76,21 +81,43 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * Entries are written to a temporary file and renamed, so concurrent readers (e.g. other processes sharing
+ * the cache directory) never observe partially written blobs. Entries are read through memory mapped files.
+ * If the size limit is set, least recently used entries are removed when the total size of blobs exceeds it.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
+    struct Entry {
+        uint64_t size = 0;
+        std::list<std::string>::iterator lruPosition;
+    };
+
     std::string m_cachePath;
+    uint64_t m_maxSize = 0;
+
+    std::mutex m_mutex;
+    std::list<std::string> m_lru;  // most recently used entries are at the front
+    std::unordered_map<std::string, Entry> m_entries;
+    uint64_t m_totalSize = 0;
+    std::atomic<uint64_t> m_evictions{0};
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void scanCacheDir();
+    void touchEntry(const std::string& id, uint64_t size);
+    void forgetEntry(const std::string& id);
+    void evict();
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Directory to store cached blobs
+     * @param maxSize Limit of the total size of cached blobs in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize = 0);
 
     /**
      * @brief Destructor
@@ -98,25 +125,24 @@ public:
      */
     ~FileStorageCacheManager() override = default;
 
-private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    /**
+     * @brief Returns the total size of cached blobs known to the cache manager in bytes
+     */
+    uint64_t getCacheSize();
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
+    /**
+     * @brief Returns the number of entries removed to fit into the size limit
+     */
+    uint64_t getEvictionsCount() const {
+        return m_evictions.load();
     }
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+private:
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
+
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
+
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,8 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -127,22 +129,58 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     public:
         struct CacheConfig {
             std::string _cacheDir;
+            uint64_t _cacheMaxSize = 0;
             std::shared_ptr<ie::ICacheManager> _cacheManager;
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
-            if (it != config.end()) {
-                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                _cacheConfig._cacheDir = it->second;
-                if (!it->second.empty()) {
-                    FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
+            auto shareIt = config.find(CONFIG_KEY(SHARE_COMPILED_MODELS));
+            if (shareIt != config.end()) {
+                if (shareIt->second == CONFIG_VALUE(YES)) {
+                    _shareCompiledModels = true;
+                } else if (shareIt->second == CONFIG_VALUE(NO)) {
+                    _shareCompiledModels = false;
                 } else {
-                    _cacheConfig._cacheManager = nullptr;
+                    IE_THROW() << "Wrong value " << shareIt->second << " for property key "
+                               << CONFIG_KEY(SHARE_COMPILED_MODELS) << ". Expected only YES/NO";
                 }
+                config.erase(shareIt);
+            }
+
+            auto dirIt = config.find(CONFIG_KEY(CACHE_DIR));
+            auto sizeIt = config.find(CONFIG_KEY(CACHE_MAX_SIZE));
+            if (dirIt == config.end() && sizeIt == config.end())
+                return;
 
-                config.erase(it);
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            if (sizeIt != config.end()) {
+                // std::stoull accepts a sign and trailing characters, so "-1" would become the maximum size
+                const auto& value = sizeIt->second;
+                bool valid = !value.empty() && value.find_first_not_of("0123456789") == std::string::npos;
+                if (valid) {
+                    try {
+                        _cacheConfig._cacheMaxSize = std::stoull(value);
+                    } catch (...) {
+                        valid = false;
+                    }
+                }
+                if (!valid) {
+                    IE_THROW() << "Wrong value " << value << " for property key " << CONFIG_KEY(CACHE_MAX_SIZE)
+                               << ". Expected non-negative integer number of bytes";
+                }
+                config.erase(sizeIt);
+            }
+            if (dirIt != config.end()) {
+                _cacheConfig._cacheDir = dirIt->second;
+                config.erase(dirIt);
+            }
+            if (!_cacheConfig._cacheDir.empty()) {
+                FileUtils::createDirectoryRecursive(_cacheConfig._cacheDir);
+                _cacheConfig._cacheManager =
+                    std::make_shared<ie::FileStorageCacheManager>(std::string(_cacheConfig._cacheDir),
+                                                                  _cacheConfig._cacheMaxSize);
+            } else {
+                _cacheConfig._cacheManager = nullptr;
             }
         }
 
@@ -152,9 +190,14 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig;
         }
 
+        bool isCompiledModelsSharingEnabled() const {
+            return _shareCompiledModels;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        std::atomic<bool> _shareCompiledModels{false};
     };
 
     // Core settings (cache config, etc)
@@ -162,6 +205,55 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     ie::CacheGuard cacheGuard;
 
+    // Models cache statistics, see METRIC_KEY(CACHE_STATISTICS)
+    struct CacheStatistics {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> importTimeUs{0};
+        std::atomic<uint64_t> compileTimeUs{0};
+    };
+    CacheStatistics cacheStatistics;
+
+    // Networks compiled by this Core, see CONFIG_KEY(SHARE_COMPILED_MODELS). Entries don't own the networks,
+    // so a network is released as usual once all the user's handles are destroyed
+    struct SharedNetwork {
+        std::weak_ptr<ie::IExecutableNetworkInternal> network;
+        std::shared_ptr<void> so;
+    };
+    std::mutex sharedNetworksMutex;
+    std::unordered_map<std::string, SharedNetwork> sharedNetworks;
+    ie::CacheGuard sharedNetworksGuard;
+
+    template <typename LoadFunc>
+    ov::runtime::SoPtr<ie::IExecutableNetworkInternal> LoadSharedNetwork(const std::string& hash, LoadFunc&& load) {
+        // concurrent loads of the same network wait for the first one instead of compiling in parallel
+        auto lock = sharedNetworksGuard.getHashLock(hash);
+        {
+            std::lock_guard<std::mutex> guard(sharedNetworksMutex);
+            auto it = sharedNetworks.find(hash);
+            if (it != sharedNetworks.end()) {
+                if (auto network = it->second.network.lock()) {
+                    return {network, it->second.so};
+                }
+                sharedNetworks.erase(it);
+            }
+        }
+
+        ov::runtime::SoPtr<ie::IExecutableNetworkInternal> res = load();
+
+        std::lock_guard<std::mutex> guard(sharedNetworksMutex);
+        for (auto it = sharedNetworks.begin(); it != sharedNetworks.end();) {
+            it = it->second.network.expired() ? sharedNetworks.erase(it) : std::next(it);
+        }
+        sharedNetworks[hash] = SharedNetwork{res._ptr, res._so};
+        return res;
+    }
+
+    static uint64_t elapsedUs(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
         std::map<std::string, std::string> defaultConfig;
@@ -241,6 +333,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         const std::string& modelPath = std::string(),
         bool forceDisableCache = false) {
         OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_impl");
+        const auto start = std::chrono::steady_clock::now();
         ov::runtime::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
         execNetwork = context ? plugin.compile_model(network, context, parsedConfig)
                               : plugin.compile_model(network, parsedConfig);
@@ -259,6 +352,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 cacheManager->removeCacheEntry(blobID);
                 throw;
             }
+            cacheStatistics.compileTimeUs += elapsedUs(start);
         }
         return execNetwork;
     }
@@ -275,6 +369,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         struct HeaderException {};
 
         OPENVINO_ASSERT(cacheManager != nullptr);
+        const auto start = std::chrono::steady_clock::now();
         try {
             cacheManager->readCacheEntry(blobId, [&](std::istream& networkStream) {
                 OV_ITT_SCOPE(FIRST_INFERENCE,
@@ -309,6 +404,12 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             // TODO: temporary disabled by #54335. In future don't throw only for new 'blob_outdated' exception
             // throw;
         }
+        if (networkIsImported) {
+            cacheStatistics.hits++;
+            cacheStatistics.importTimeUs += elapsedUs(start);
+        } else {
+            cacheStatistics.misses++;
+        }
         return execNetwork;
     }
 
@@ -609,22 +710,31 @@ public:
             parsed._config.erase(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE));
         }
         auto plugin = GetCPPPluginByName(parsed._deviceName);
-        ov::runtime::SoPtr<ie::IExecutableNetworkInternal> res;
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
-        if (!forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin)) {
-            auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
-            bool loadedFromCache = false;
-            auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
-            if (!loadedFromCache) {
-                res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
+        const bool useCache = !forceDisableCache && cacheManager && DeviceSupportsImportExport(plugin);
+        const bool shareNetwork = !forceDisableCache && coreConfig.isCompiledModelsSharingEnabled();
+        std::string hash;
+        if (useCache || shareNetwork) {
+            hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+        }
+        auto load = [&]() {
+            ov::runtime::SoPtr<ie::IExecutableNetworkInternal> res;
+            if (useCache) {
+                bool loadedFromCache = false;
+                auto lock = cacheGuard.getHashLock(hash);
+                res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+                if (!loadedFromCache) {
+                    res = compile_model_impl(network, plugin, parsed._config, nullptr, hash, {}, forceDisableCache);
+                } else {
+                    // Temporary workaround until all plugins support caching of original model inputs
+                    InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
+                }
             } else {
-                // Temporary workaround until all plugins support caching of original model inputs
-                InferenceEngine::SetExeNetworkInfo(res._ptr, network.getFunction(), isNewAPI());
+                res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache);
             }
-        } else {
-            res = compile_model_impl(network, plugin, parsed._config, nullptr, {}, {}, forceDisableCache);
-        }
+            return res;
+        };
+        auto res = shareNetwork ? LoadSharedNetwork(hash, load) : load();
         return {res._ptr, res._so};
     }
 
@@ -634,23 +744,38 @@ public:
         OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::Path");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         auto plugin = GetCPPPluginByName(parsed._deviceName);
-        ov::runtime::SoPtr<ie::IExecutableNetworkInternal> res;
         auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
-        if (cacheManager && DeviceSupportsImportExport(plugin)) {
-            bool loadedFromCache = false;
-            auto hash = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
-            auto lock = cacheGuard.getHashLock(hash);
-            res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache, modelPath);
-            if (!loadedFromCache) {
+        const bool useCache = cacheManager && DeviceSupportsImportExport(plugin);
+        const bool shareNetwork = coreConfig.isCompiledModelsSharingEnabled();
+        std::string hash;
+        if (useCache || shareNetwork) {
+            hash = CalculateFileHash(modelPath, parsed._deviceName, plugin, parsed._config);
+        }
+        auto load = [&]() {
+            ov::runtime::SoPtr<ie::IExecutableNetworkInternal> res;
+            if (useCache) {
+                bool loadedFromCache = false;
+                auto lock = cacheGuard.getHashLock(hash);
+                res = LoadNetworkFromCache(cacheManager,
+                                           hash,
+                                           plugin,
+                                           parsed._config,
+                                           nullptr,
+                                           loadedFromCache,
+                                           modelPath);
+                if (!loadedFromCache) {
+                    auto cnnNetwork = ReadNetwork(modelPath, std::string());
+                    res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                }
+            } else if (cacheManager) {
+                res = plugin.compile_model(modelPath, parsed._config);
+            } else {
                 auto cnnNetwork = ReadNetwork(modelPath, std::string());
-                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, hash, modelPath);
+                res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, {}, modelPath);
             }
-        } else if (cacheManager) {
-            res = plugin.compile_model(modelPath, parsed._config);
-        } else {
-            auto cnnNetwork = ReadNetwork(modelPath, std::string());
-            res = compile_model_impl(cnnNetwork, plugin, parsed._config, nullptr, {}, modelPath);
-        }
+            return res;
+        };
+        auto res = shareNetwork ? LoadSharedNetwork(hash, load) : load();
         return {res._ptr, res._so};
     }
 
@@ -753,9 +878,30 @@ public:
         return res;
     }
 
+    std::map<std::string, uint64_t> GetCacheStatistics() const {
+        std::map<std::string, uint64_t> statistics = {{"hits", cacheStatistics.hits.load()},
+                                                      {"misses", cacheStatistics.misses.load()},
+                                                      {"import_time_us", cacheStatistics.importTimeUs.load()},
+                                                      {"compile_time_us", cacheStatistics.compileTimeUs.load()},
+                                                      {"size_bytes", 0},
+                                                      {"evictions", 0}};
+        auto fileCacheManager =
+            std::dynamic_pointer_cast<ie::FileStorageCacheManager>(coreConfig.getCacheConfig()._cacheManager);
+        if (fileCacheManager) {
+            statistics["size_bytes"] = fileCacheManager->getCacheSize();
+            statistics["evictions"] = fileCacheManager->getEvictionsCount();
+        }
+        return statistics;
+    }
+
     ie::Parameter GetMetric(const std::string& deviceName,
                             const std::string& name,
                             const ie::ParamMap& options = {}) const override {
+        // Core metrics
+        if (deviceName.empty() && name == METRIC_KEY(CACHE_STATISTICS)) {
+            return GetCacheStatistics();
+        }
+
         // HETERO case
         {
             if (deviceName.find("HETERO:") == 0) {
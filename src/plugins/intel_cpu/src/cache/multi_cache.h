@@ -45,7 +45,17 @@ public:
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
         auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        auto result = entry->getOrCreate(key, std::move(builder));
+        if (result.second == CacheEntryBase::LookUpStatus::Miss)
+            _misses++;
+        return result;
+    }
+
+    /**
+    * @return total number of cache misses, used to attribute misses to nodes in performance counters
+    */
+    size_t getMissesCount() const {
+        return _misses;
     }
 
 private:
@@ -57,6 +67,7 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    size_t _misses = 0;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -129,6 +130,21 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == CPUConfigParams::KEY_CPU_MEMORY_ALLOCATOR) {
+            if (val == CPUConfigParams::CPU_MEMORY_ALLOCATOR_DEFAULT)
+                memoryAllocator = MKLDNNMemoryAllocator::Type::Default;
+            else if (val == CPUConfigParams::CPU_MEMORY_ALLOCATOR_HUGE_PAGES)
+                memoryAllocator = MKLDNNMemoryAllocator::Type::HugePages;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_ALLOCATOR
+                           << ". Expected only " << CPUConfigParams::CPU_MEMORY_ALLOCATOR_DEFAULT << "/"
+                           << CPUConfigParams::CPU_MEMORY_ALLOCATOR_HUGE_PAGES;
+        } else if (key == CPUConfigParams::KEY_CPU_MEMORY_POOL) {
+            if (val == PluginConfigParams::YES) memoryPool = true;
+            else if (val == PluginConfigParams::NO) memoryPool = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_POOL
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -183,6 +199,14 @@ void Config::updateProperties() {
         _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
                          std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
         _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+        if (memoryAllocator == MKLDNNMemoryAllocator::Type::HugePages)
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ALLOCATOR, CPUConfigParams::CPU_MEMORY_ALLOCATOR_HUGE_PAGES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_ALLOCATOR, CPUConfigParams::CPU_MEMORY_ALLOCATOR_DEFAULT });
+        if (memoryPool)
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_POOL, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_POOL, PluginConfigParams::NO });
     }
 }
 
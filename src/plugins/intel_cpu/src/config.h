@@ -7,6 +7,7 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include "utils/debug_capabilities.h"
+#include "mkldnn_memory_allocator.h"
 
 #include <string>
 #include <map>
@@ -27,6 +28,8 @@ struct Config {
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 100ul;
+    MKLDNNMemoryAllocator::Type memoryAllocator = MKLDNNMemoryAllocator::Type::Default;
+    bool memoryPool = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
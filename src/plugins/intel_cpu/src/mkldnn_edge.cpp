@@ -266,6 +266,7 @@ void MKLDNNEdge::allocate(const void* mem_ptr) {
         IE_THROW() << "Cannot allocate memory for incompatible descriptors.";
 
     auto parentPtr = getParent();
+    MKLDNNMemoryAllocationScope scope(parentPtr->isConstant() ? MemoryCategory::Weights : MemoryCategory::Activations);
     memoryPtr.reset(new MKLDNNMemory(parentPtr->getEngine()));
 
     memoryPtr->Create(inputDesc, mem_ptr, false);  // no pads zeroing
@@ -369,6 +370,7 @@ const MKLDNNMemory &MKLDNNEdge::getMemory() {
 
 MKLDNNMemoryPtr &MKLDNNEdge::getMemoryPtr() {
     if (status == Status::NotAllocated) {
+        MKLDNNMemoryAllocationScope scope(MemoryCategory::Activations);
         memoryPtr.reset(new MKLDNNMemory(getParent()->getEngine()));
         const auto &desc = getDesc();
         memoryPtr->Create(desc, desc.isDefined() ? getSharedEdge()->getMemoryPtr()->GetData() : nullptr);
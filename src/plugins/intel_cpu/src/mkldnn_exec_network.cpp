@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
 #include "mkldnn_exec_network.h"
 
@@ -23,6 +24,7 @@
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 #include <ngraph/opsets/opset1.hpp>
 #include <transformations/utils/utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
@@ -155,6 +157,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
+                    graphLock._graph.setMemoryAllocator(GetMemoryAllocator(numaNodeId));
                 }
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
@@ -173,6 +176,17 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+MKLDNNMemoryAllocator::Ptr MKLDNNExecNetwork::GetMemoryAllocator(int numaNodeId) const {
+    auto& allocator = _memoryAllocators[numaNodeId];
+    if (!allocator) {
+        // binding makes sense only if memory of the stream may be placed on another node
+        const bool bindToNuma = getAvailableNUMANodes().size() > 1;
+        allocator = MKLDNNMemoryAllocator::create(_cfg.memoryAllocator, _cfg.memoryPool,
+                                                  bindToNuma ? numaNodeId : -1, _memoryStatistics);
+    }
+    return allocator;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -220,6 +234,9 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPU_METRIC_KEY(NODES_PROFILING));
+        metrics.push_back(CPU_METRIC_KEY(ELIMINATED_DATA_PASSES));
+        metrics.push_back(CPU_METRIC_KEY(MEMORY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -234,6 +251,37 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPU_METRIC_KEY(NODES_PROFILING)) {
+        // graphs are not blocked by running inferences, so counters can be collected from a working network
+        std::stringstream profiling;
+        profiling << "{\"streams\":[";
+        bool first = true;
+        for (auto& graph : _graphs) {
+            auto graphLock = Graph::Lock(graph);
+            if (!graphLock._graph.IsReady())
+                continue;
+            if (!first)
+                profiling << ",";
+            first = false;
+            graphLock._graph.DumpPerfHistograms(profiling);
+        }
+        profiling << "]}";
+        IE_SET_METRIC_RETURN(CPU_NODES_PROFILING, profiling.str());
+    } else if (name == CPU_METRIC_KEY(ELIMINATED_DATA_PASSES)) {
+        // graphs of all streams are optimized in the same way
+        IE_SET_METRIC_RETURN(CPU_ELIMINATED_DATA_PASSES, static_cast<unsigned int>(GetGraph()._graph.GetEliminatedDataPasses()));
+    } else if (name == CPU_METRIC_KEY(MEMORY_STATISTICS)) {
+        size_t pooled = 0;
+        {
+            std::lock_guard<std::mutex> lock{_cfgMutex};
+            for (const auto& allocator : _memoryAllocators)
+                pooled += allocator.second->getPooledSize();
+        }
+        std::stringstream statistics;
+        statistics << "{\"categories\":";
+        _memoryStatistics->dump(statistics);
+        statistics << ",\"pooled\":" << pooled << "}";
+        IE_SET_METRIC_RETURN(CPU_MEMORY_STATISTICS, statistics.str());
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -66,6 +66,9 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    // the memory of the graphs of all streams is accounted together, the allocators are per NUMA node
+    std::shared_ptr<MKLDNNMemoryStatistics>     _memoryStatistics = std::make_shared<MKLDNNMemoryStatistics>();
+    mutable std::map<int, MKLDNNMemoryAllocator::Ptr> _memoryAllocators;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -73,6 +76,9 @@ protected:
      */
     Graph::Lock GetGraph() const;
 
+    // must be called with _cfgMutex locked
+    MKLDNNMemoryAllocator::Ptr GetMemoryAllocator(int numaNodeId) const;
+
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstdio>
 #include <string>
 #include <map>
 #include <vector>
@@ -72,6 +73,8 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
 
     rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
 
+    // memory of nodes is allocated on all the stages of the graph creation
+    MKLDNNMemoryAllocationScope allocationScope(memoryAllocator, MemoryCategory::Scratchpad);
     Replicate(net, extMgr);
     InitGraph();
 
@@ -441,21 +444,6 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     }
 }
 
-static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
-    memory::desc dstMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(childDesc.clone())->getDnnlDesc();
-    memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(parentDesc.clone())->getDnnlDesc();
-    mkldnn::primitive_attr attr;
-
-    dnnl_primitive_desc_t result = nullptr;
-    auto status = dnnl_reorder_primitive_desc_create(&result, &srcMemDesc.data, eng.get(), &dstMemDesc.data, eng.get(),
-                                                     attr.get());
-    if (result) {
-        mkldnn_primitive_desc_destroy(result);
-    }
-
-    return mkldnn_success == status;
-}
-
 void MKLDNNGraph::InitEdges() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitEdges");
 
@@ -495,7 +483,7 @@ void MKLDNNGraph::InitEdges() {
             MKLDNNEdge::ReorderStatus reorderStatusInternal = MKLDNNEdge::ReorderStatus::Regular;
             // Check if there is a reorder that needs the precision conversion
             if (edge->getInputDesc().getPrecision() != edge->getOutputDesc().getPrecision() &&
-                    !isReorderAvailable(edge->getInputDesc(), edge->getOutputDesc(), this->getEngine())) {
+                    !MKLDNNReorderNode::isReorderAvailable(edge->getInputDesc(), edge->getOutputDesc(), this->getEngine())) {
                 // If we are here, then we need to insert Convert, because there are no reorders that support such type conversion
                 const auto& inDesc = edge->getInputDesc();
                 const auto& outDesc = edge->getOutputDesc();
@@ -654,7 +642,10 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+    {
+        MKLDNNMemoryAllocationScope allocationScope(MemoryCategory::Activations);
+        memWorkspace = std::make_shared<MKLDNNMemory>(eng);
+    }
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
     if (edge_clusters.empty())
@@ -821,7 +812,6 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             outBloMem.SetData(intr_blob, 0, false);
         } else {
             size_t size_to_copy = intr_blob.GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-            // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
             // TODO [DS]: phase 2: should we support this behaviour? Looks obsolete in the dynamic shapes paradigm
             if (config.batchLimit) {
                 if (node->isDynamicNode()) {
@@ -847,12 +837,31 @@ inline void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::st
     }
 }
 
+void MKLDNNGraph::SetDynamicBatch(int batch) {
+    // the memory planned for the max batch is reused, only the processed part of it is changed
+    if (batch == dynBatch && batch == config.batchLimit)
+        return;
+    // reduced memory objects are recreated even for the same batch, because the request
+    // may have changed data handles of the input and output memory since the last call
+    for (const auto& node : graphNodes) {
+        node->setDynamicBatchLim(batch);
+    }
+    dynBatch = batch;
+}
+
 void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
+    if (config.batchLimit) {
+        // a request which has never called SetBatch() processes the whole batch
+        SetDynamicBatch(batch > 0 ? batch : config.batchLimit);
+    }
+
     mkldnn::stream stream(eng);
+    // nodes of dynamic shapes may allocate memory on execution
+    MKLDNNMemoryAllocationScope allocationScope(memoryAllocator, MemoryCategory::Scratchpad);
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, config.verbose);
@@ -982,6 +991,69 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     }
 }
 
+// node names come from the model, so quotes, backslashes and control characters must be escaped
+static std::string escapeJson(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\b': result += "\\b"; break;
+            case '\f': result += "\\f"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[7];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+                    result += code;
+                } else {
+                    result += c;
+                }
+        }
+    }
+    return result;
+}
+
+void MKLDNNGraph::DumpPerfHistograms(std::ostream& os) const {
+    os << "[";
+    bool first = true;
+    for (const auto& node : executableGraphNodes) {
+        const auto& counter = node->PerfCounter();
+        if (!first)
+            os << ",";
+        first = false;
+
+        os << "{\"name\":\"" << escapeJson(node->getName()) << "\","
+           << "\"type\":\"" << escapeJson(node->getTypeStr()) << "\","
+           << "\"exec_type\":\"" << node->getPrimitiveDescriptorType() << "\","
+           << "\"count\":" << counter.count() << ","
+           << "\"avg_us\":" << counter.avg() << ","
+           << "\"p50_us\":" << counter.percentile(50) << ","
+           << "\"p90_us\":" << counter.percentile(90) << ","
+           << "\"p99_us\":" << counter.percentile(99) << ","
+           << "\"max_us\":" << counter.max() << ","
+           << "\"prepare_params\":" << counter.prepareParamsCount() << ","
+           << "\"prepare_params_us\":" << counter.prepareParamsDuration() << ","
+           << "\"cache_misses\":" << counter.cacheMisses() << ","
+           << "\"histogram_us\":{";
+        // only non-empty buckets are reported, key is the bucket upper bound
+        bool firstBucket = true;
+        for (size_t i = 0; i < PerfCount::histogramSize; i++) {
+            if (counter.bucket(i) == 0)
+                continue;
+            if (!firstBucket)
+                os << ",";
+            firstBucket = false;
+            os << "\"" << PerfCount::bucketUpperBound(i) << "\":" << counter.bucket(i);
+        }
+        os << "}}";
+    }
+    os << "]";
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -45,6 +45,14 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the allocator of the memory of the graph, should be called before CreateGraph.
+     * Graphs without an allocator (bodies of TensorIterator, If) use the allocator of the enclosing graph.
+     */
+    void setMemoryAllocator(const MKLDNNMemoryAllocator::Ptr& allocator) {
+        memoryAllocator = allocator;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const MKLDNNExtensionManager::Ptr& extMgr,
@@ -107,6 +115,23 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Dumps per node execution time histograms, prepareParams and runtime cache miss counters as JSON array
+     * Can be called while the graph is executed by another thread
+     */
+    void DumpPerfHistograms(std::ostream& os) const;
+
+    /**
+     * @brief Number of passes over memory per inference (executions of Reorder, Convert and Transpose nodes)
+     * eliminated by the graph optimizer merging chains of these nodes
+     */
+    size_t GetEliminatedDataPasses() const {
+        return eliminatedDataPasses;
+    }
+    void AddEliminatedDataPasses(size_t count) {
+        eliminatedDataPasses += count;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(MKLDNNEdgePtr& edge);
@@ -196,6 +221,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        eliminatedDataPasses = 0;
     }
     Status status { NotReady };
     Config config;
@@ -204,6 +230,10 @@ protected:
     // values mean increment it within each Infer() call
     int infer_count = -1;
 
+    // Batch the nodes are set up for when dynamic batch is enabled. The graph is shared by
+    // infer requests with different batches, so it's applied on every Infer() call.
+    int dynBatch = -1;
+
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
@@ -216,6 +246,7 @@ protected:
 
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
+    size_t eliminatedDataPasses = 0;
 
     static mkldnn::engine eng;
 
@@ -232,6 +263,7 @@ protected:
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    void SetDynamicBatch(int batch);
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -249,6 +281,7 @@ private:
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
     MultiCachePtr rtParamsCache;
+    MKLDNNMemoryAllocator::Ptr memoryAllocator;
 
     void EnforceBF16();
 };
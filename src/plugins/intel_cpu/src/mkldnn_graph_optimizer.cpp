@@ -142,6 +142,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseReduceAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInputConvertAndEltwise");
+    FuseInputConvertAndEltwise(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvertAndGather");
+    FuseConvertAndGather(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -157,6 +165,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
 void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &graph) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations");
 
+    MergeConvertAndReorder(graph);
+    graph.RemoveDroppedNodes();
+
     DropDoubleReorders(graph);
     graph.RemoveDroppedNodes();
 
@@ -1438,6 +1449,93 @@ void MKLDNNGraphOptimizer::FuseReduceAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+/**
+ * Preprocessing produced by ov::preprocess::PrePostProcessor usually looks like
+ * Parameter[U8] -> Convert[FP32] -> Subtract(mean) -> Multiply/Divide(scale) -> ...
+ * Eltwise jitter is able to load integer data and convert it to the execution precision on the fly,
+ * so the Convert is dropped and the whole chain is executed by a single Eltwise kernel
+ * after the subsequent FuseEltwiseAndSimple pass. This saves a full pass over the input memory per request.
+ */
+void MKLDNNGraphOptimizer::FuseInputConvertAndEltwise(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->isConstant() || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto parent = node->getParentEdgesAtPort(0)[0]->getParent();
+        if (parent->getType() != Input || parent->isConstant())
+            return false;
+
+        return one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) &&
+               one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    auto isSuitableEltwiseNode = [](const MKLDNNNodePtr& convertNode, const MKLDNNNodePtr& node, int port) {
+        if (node->getType() != Eltwise || !node->getFusedWith().empty())
+            return false;
+
+        if (node->getOriginalInputPrecisionAtPort(port) != convertNode->getOriginalOutputPrecisionAtPort(0))
+            return false;
+
+        // At least one more floating point input guarantees that Eltwise keeps FP32 execution precision,
+        // so the result is bit-exact with the separate Convert
+        for (int i = 0; i < node->getOriginalInputsNumber(); i++) {
+            if (i != port && one_of(node->getOriginalInputPrecisionAtPort(i), Precision::FP32, Precision::BF16))
+                return true;
+        }
+        return false;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto convertNode = graphNodes[i];
+        if (!isSuitableConvertNode(convertNode))
+            continue;
+
+        auto childEdge = convertNode->getChildEdgeAt(0);
+        auto childNode = childEdge->getChild();
+        const int port = childEdge->getOutputNum();
+        if (!isSuitableEltwiseNode(convertNode, childNode, port))
+            continue;
+
+        childNode->setOriginalInputPrecisionAtPort(port, convertNode->getOriginalInputPrecisionAtPort(0));
+        childNode->addOriginalLayer(convertNode->getOriginalLayers());
+        graph.DropNode(convertNode);
+    }
+}
+
+/**
+ * Embedding tables are often stored as Constant[I8/U8] -> Convert[FP32] (folding is disabled by DisableGatherConvertFolding).
+ * Gather reads the compressed table and converts only the gathered rows, so the table is never expanded to FP32.
+ */
+void MKLDNNGraphOptimizer::FuseConvertAndGather(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->getChildEdges().size() != 1)
+            return false;
+
+        return one_of(node->getOriginalInputPrecisionAtPort(0), Precision::U8, Precision::I8) &&
+               one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto convertNode = graphNodes[i];
+        if (!isSuitableConvertNode(convertNode))
+            continue;
+
+        auto childEdge = convertNode->getChildEdgeAt(0);
+        auto childNode = childEdge->getChild();
+        if (childNode->getType() != Gather || childEdge->getOutputNum() != 0 ||
+            childNode->getOriginalOutputPrecisionAtPort(0) != convertNode->getOriginalOutputPrecisionAtPort(0))
+            continue;
+
+        childNode->setOriginalInputPrecisionAtPort(0, convertNode->getOriginalInputPrecisionAtPort(0));
+        childNode->addOriginalLayer(convertNode->getOriginalLayers());
+        graph.DropNode(convertNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1608,6 +1706,7 @@ void MKLDNNGraphOptimizer::DropDoubleReorders(MKLDNNGraph &graph) {
             std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
             graph.InsertReorder(edge, layerName, n->getInput(), nn->getOutput(), false);
             graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+            graph.AddEliminatedDataPasses(1);
         }
     }
 }
@@ -1982,6 +2081,7 @@ void MKLDNNGraphOptimizer::MergeTransposeAndReorder(MKLDNNGraph &graph) {
         }
 
         auto reorderNode = graph.InsertReorder(edge, reorderlayerName, *reorderInDesc, *reorderOutDesc, true);
+        graph.AddEliminatedDataPasses(inPrec == outPrec ? 2 : 1);
 
         // case 2
         if (inPrec != outPrec) {
@@ -2011,6 +2111,90 @@ void MKLDNNGraphOptimizer::MergeTransposeAndReorder(MKLDNNGraph &graph) {
     }
 }
 
+/**
+ * Convert nodes (from the model or inserted for precisions oneDNN reorders don't support) often neighbour
+ * Reorders inserted for layout changes, e.g. Input[U8, nchw] -> Convert[FP32] -> Reorder[nChw16c].
+ * Such a chain makes a full pass over the memory per node, while a single oneDNN reorder can change
+ * the precision and the layout at once. Only exact conversions are merged, since Convert truncates
+ * and reorder rounds when converting floating point values to integers.
+ */
+void MKLDNNGraphOptimizer::MergeConvertAndReorder(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isExactConversion = [](const Precision& from, const Precision& to) {
+        return (one_of(from, Precision::U8, Precision::I8) && one_of(to, Precision::I32, Precision::FP32, Precision::BF16)) ||
+               (from == Precision::BF16 && to == Precision::FP32);
+    };
+
+    auto isSuitableConvertNode = [&](const MKLDNNNodePtr& node) {
+        if (node->getType() != Convert || node->isDynamicNode() || node->isConstant() || !node->getFusedWith().empty() ||
+            node->getParentEdges().size() != 1 || node->getChildEdges().size() != 1)
+            return false;
+
+        const auto& config = node->getSelectedPrimitiveDescriptor()->getConfig();
+        return isExactConversion(config.inConfs[0].desc->getPrecision(), config.outConfs[0].desc->getPrecision());
+    };
+
+    auto isSuitableReorderNode = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Reorder || node->isDynamicNode() || node->isConstant() || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* reorderNode = dynamic_cast<MKLDNNReorderNode*>(node.get());
+        if (reorderNode == nullptr)
+            IE_THROW() << "Cannot get reorder layer " << node->getName();
+        return !reorderNode->getOptimized();
+    };
+
+    // replaces the sequence of two nodes with a single Reorder from the input of the first one to the output of the second one
+    auto mergeIntoReorder = [&](const MKLDNNNodePtr& firstNode, const MKLDNNNodePtr& secondNode) {
+        const auto& inDesc = firstNode->getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc;
+        const auto& outDesc = secondNode->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc;
+        if (!MKLDNNReorderNode::isReorderAvailable(*inDesc, *outDesc, graph.getEngine()))
+            return false;
+
+        auto parentEdge = firstNode->getParentEdgeAt(0);
+        auto parentNode = parentEdge->getParent();
+        const auto parentPort = parentEdge->getInputNum();
+        auto childEdge = secondNode->getChildEdgeAt(0);
+        auto childNode = childEdge->getChild();
+        const auto childPort = childEdge->getOutputNum();
+
+        graph.DropNode(firstNode);
+        graph.DropNode(secondNode);
+
+        MKLDNNEdgePtr edge;
+        for (const auto& cur : parentNode->getChildEdgesAtPort(parentPort)) {
+            if (cur->getChild() == childNode && cur->getOutputNum() == childPort)
+                edge = cur;
+        }
+        if (!edge)
+            IE_THROW() << "Inappropriate graph processing";
+
+        std::string layerName = parentNode->getName() + "_" + MKLDNNReorderNode::getReorderArgs(*inDesc, *outDesc) + "_" + childNode->getName();
+        auto reorderNode = graph.InsertReorder(edge, layerName, *inDesc, *outDesc, false);
+        reorderNode->addOriginalLayer(firstNode->getOriginalLayers());
+        reorderNode->addOriginalLayer(secondNode->getOriginalLayers());
+        graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+        graph.AddEliminatedDataPasses(1);
+        return true;
+    };
+
+    // Reorder -> Convert -> Reorder becomes two Reorders here, DropDoubleReorders merges them after that
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto convertNode = graphNodes[i];
+        if (!isSuitableConvertNode(convertNode))
+            continue;
+
+        auto childNode = convertNode->getChildEdgeAt(0)->getChild();
+        if (isSuitableReorderNode(childNode) && mergeIntoReorder(convertNode, childNode))
+            continue;
+
+        auto parentNode = convertNode->getParentEdgeAt(0)->getParent();
+        if (isSuitableReorderNode(parentNode))
+            mergeIntoReorder(parentNode, convertNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::reshapeRnnSeq(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
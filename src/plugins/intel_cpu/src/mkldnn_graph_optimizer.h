@@ -37,10 +37,13 @@ private:
     void DropDoubleReorders(MKLDNNGraph& graph);
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
+    void FuseInputConvertAndEltwise(MKLDNNGraph &graph);
+    void FuseConvertAndGather(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(MKLDNNGraph &graph);
     void FuseClampAndFakeQuantize(MKLDNNGraph &graph);
     void MergeTransposeAndReorder(MKLDNNGraph &graph);
+    void MergeConvertAndReorder(MKLDNNGraph &graph);
     void reshapeRnnSeq(MKLDNNGraph &graph);
 };
 
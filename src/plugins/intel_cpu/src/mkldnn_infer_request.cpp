@@ -625,11 +625,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
             " for this request.";
     }
 
+    // the graph is shared by the infer requests of a stream, so the batch is applied by the graph on Infer()
     m_curBatch = new_batch;
-
-    for (const auto& node : graph->GetNodes()) {
-        node->setDynamicBatchLim(new_batch);
-    }
 }
 
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
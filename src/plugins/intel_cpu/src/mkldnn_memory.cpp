@@ -38,7 +38,9 @@ namespace {
     }
 }   // namespace
 
-MKLDNNMemory::MKLDNNMemory(const mkldnn::engine& eng) : eng(eng) {}
+MKLDNNMemory::MKLDNNMemory(const mkldnn::engine& eng) : eng(eng),
+        allocator(MKLDNNMemoryAllocationScope::currentAllocator()),
+        category(MKLDNNMemoryAllocationScope::currentCategory()) {}
 
 size_t MKLDNNMemory::GetSize() const {
     auto size = getDesc().getCurrentMemSize();
@@ -59,7 +61,15 @@ void MKLDNNMemory::Create(const memory::dims& dims, memory::data_type data_type,
 }
 
 void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bool pads_zeroing) {
-    if (data == nullptr) {
+    if (data == nullptr && allocator) {
+        auto newData = allocator->allocate(desc.get_size(), category);
+        prim.reset(new memory(desc, eng, DNNL_MEMORY_NONE));
+        if (pads_zeroing)
+            prim->set_data_handle(newData.get());
+        else
+            prim->set_data_handle_no_pads_proc(newData.get());
+        allocatedData = std::move(newData);
+    } else if (data == nullptr) {
         prim.reset(new memory(desc, eng));
 
         size_t real_size = 0;
@@ -85,6 +95,8 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
             prim->set_data_handle_no_pads_proc(const_cast<void*>(data));
         //
         // ========================
+        if (allocatedData && allocatedData.get() != data)
+            allocatedData.reset();
     }
 }
 
@@ -13,6 +13,7 @@
 #include <cpu_shape.h>
 
 #include "memory_desc/dnnl_memory_desc.h"
+#include "mkldnn_memory_allocator.h"
 
 #include <string>
 #include <functional>
@@ -27,6 +28,9 @@
  * memory descriptor and raw buffer handler to contains data. In case of system memory raw buffer it's simple
  * "void*" on some system memory buffer.
  *
+ * The buffer is allocated by the allocator of the MKLDNNMemoryAllocationScope the object is created in,
+ * or by oneDNN if there is no such scope.
+ *
  */
 
 namespace MKLDNNPlugin {
@@ -126,6 +130,9 @@ private:
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
+    MKLDNNMemoryAllocator::Ptr allocator;
+    MemoryCategory category;
+    std::shared_ptr<void> allocatedData;
 };
 
 using MKLDNNMemoryPtr = std::shared_ptr<MKLDNNMemory>;
@@ -0,0 +1,323 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_allocator.h"
+
+#include <ie_common.h>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+namespace {
+
+constexpr size_t pageSize = 4 * 1024;
+// a pooled block is reused only if at most a half of it is left unused
+constexpr size_t maxReuseFactor = 2;
+
+size_t roundUp(size_t size, size_t granularity) {
+    return (size + granularity - 1) / granularity * granularity;
+}
+
+size_t categoryIndex(MemoryCategory category) {
+    return static_cast<size_t>(category);
+}
+
+void* alignedMalloc(size_t size, size_t alignment) {
+    void* ptr = nullptr;
+#ifdef _WIN32
+    ptr = _aligned_malloc(size, alignment);
+#else
+    if (posix_memalign(&ptr, alignment, size) != 0)
+        ptr = nullptr;
+#endif
+    if (ptr == nullptr)
+        IE_THROW() << "Cannot allocate " << size << " bytes of memory";
+    return ptr;
+}
+
+void alignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+class DefaultMemoryAllocator : public MKLDNNMemoryAllocator {
+public:
+    DefaultMemoryAllocator(bool pooled, size_t poolLimit, std::shared_ptr<MKLDNNMemoryStatistics> statistics)
+        : MKLDNNMemoryAllocator(Type::Default, pooled, poolLimit, std::move(statistics)) {}
+
+    ~DefaultMemoryAllocator() override {
+        releasePool();
+    }
+
+protected:
+    void* allocateBlock(size_t size) override {
+        return alignedMalloc(size, alignment);
+    }
+
+    void freeBlock(void* ptr, size_t) override {
+        alignedFree(ptr);
+    }
+};
+
+#if defined(__linux__)
+/**
+ * Buffers larger than a half of a huge page are mapped on 2 MB pages: reserved huge pages (hugetlbfs) are used
+ * when available, otherwise a 2 MB aligned mapping is advised to be backed by transparent huge pages.
+ * Smaller buffers are taken from the heap, a huge page for each of them would waste most of the memory.
+ */
+class HugePagesMemoryAllocator : public MKLDNNMemoryAllocator {
+public:
+    static constexpr size_t hugePageSize = 2 * 1024 * 1024;
+
+    HugePagesMemoryAllocator(bool pooled, size_t poolLimit, int numaNodeId,
+                             std::shared_ptr<MKLDNNMemoryStatistics> statistics)
+        : MKLDNNMemoryAllocator(Type::HugePages, pooled, poolLimit, std::move(statistics)), numaNodeId(numaNodeId) {}
+
+    ~HugePagesMemoryAllocator() override {
+        releasePool();
+    }
+
+protected:
+    size_t blockSize(size_t size) const override {
+        if (isHuge(size))
+            return roundUp(size, hugePageSize);
+        return MKLDNNMemoryAllocator::blockSize(size);
+    }
+
+    void* allocateBlock(size_t size) override {
+        if (!isHuge(size))
+            return alignedMalloc(size, alignment);
+
+        void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+        if (ptr == MAP_FAILED) {
+            ptr = mapAligned(size);
+#ifdef MADV_HUGEPAGE
+            madvise(ptr, size, MADV_HUGEPAGE);
+#endif
+        }
+        bindToNumaNode(ptr, size);
+        return ptr;
+    }
+
+    void freeBlock(void* ptr, size_t size) override {
+        if (!isHuge(size)) {
+            alignedFree(ptr);
+            return;
+        }
+        munmap(ptr, size);
+    }
+
+private:
+    static bool isHuge(size_t size) {
+        return size >= hugePageSize / 2;
+    }
+
+    // transparent huge pages back only the 2 MB aligned ranges of a mapping
+    static void* mapAligned(size_t size) {
+        const size_t mappedSize = size + hugePageSize;
+        void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapped == MAP_FAILED)
+            IE_THROW() << "Cannot allocate " << size << " bytes of memory";
+
+        auto begin = reinterpret_cast<uintptr_t>(mapped);
+        auto alignedBegin = roundUp(begin, hugePageSize);
+        if (alignedBegin != begin)
+            munmap(mapped, alignedBegin - begin);
+        const size_t tail = begin + mappedSize - (alignedBegin + size);
+        if (tail != 0)
+            munmap(reinterpret_cast<void*>(alignedBegin + size), tail);
+        return reinterpret_cast<void*>(alignedBegin);
+    }
+
+    // the pages are not touched yet, so the policy defines where they are placed on the first touch
+    void bindToNumaNode(void* ptr, size_t size) const {
+#ifdef SYS_mbind
+        if (numaNodeId < 0 || numaNodeId >= static_cast<int>(sizeof(unsigned long) * 8))
+            return;
+        // preferred policy instead of the strict binding, so the memory of a full node is taken from another one
+        constexpr int mpolPreferred = 1;
+        const unsigned long nodeMask = 1ul << numaNodeId;
+        syscall(SYS_mbind, ptr, size, mpolPreferred, &nodeMask, sizeof(nodeMask) * 8, 0);
+#endif
+    }
+
+    const int numaNodeId;
+};
+#endif
+
+}  // namespace
+
+MKLDNNMemoryStatistics::MKLDNNMemoryStatistics() {
+    for (auto& category : counters) {
+        category.allocated = 0;
+        category.peak = 0;
+        category.allocations = 0;
+    }
+}
+
+void MKLDNNMemoryStatistics::add(MemoryCategory category, size_t size) {
+    auto& counter = counters[categoryIndex(category)];
+    const size_t allocated = counter.allocated.fetch_add(size) + size;
+    size_t peak = counter.peak.load();
+    while (peak < allocated && !counter.peak.compare_exchange_weak(peak, allocated)) {}
+    counter.allocations++;
+}
+
+void MKLDNNMemoryStatistics::remove(MemoryCategory category, size_t size) {
+    counters[categoryIndex(category)].allocated.fetch_sub(size);
+}
+
+size_t MKLDNNMemoryStatistics::allocated(MemoryCategory category) const {
+    return counters[categoryIndex(category)].allocated.load();
+}
+
+size_t MKLDNNMemoryStatistics::peak(MemoryCategory category) const {
+    return counters[categoryIndex(category)].peak.load();
+}
+
+size_t MKLDNNMemoryStatistics::allocations(MemoryCategory category) const {
+    return counters[categoryIndex(category)].allocations.load();
+}
+
+void MKLDNNMemoryStatistics::dump(std::ostream& out) const {
+    const std::pair<MemoryCategory, const char*> categories[] = {
+        {MemoryCategory::Weights, "weights"},
+        {MemoryCategory::Activations, "activations"},
+        {MemoryCategory::Scratchpad, "scratchpad"},
+    };
+    out << "{";
+    for (size_t i = 0; i < categoriesCount; i++) {
+        const auto category = categories[i].first;
+        out << (i ? "," : "") << "\"" << categories[i].second << "\":{"
+            << "\"allocated\":" << allocated(category) << ","
+            << "\"peak\":" << peak(category) << ","
+            << "\"allocations\":" << allocations(category) << "}";
+    }
+    out << "}";
+}
+
+MKLDNNMemoryAllocator::Ptr MKLDNNMemoryAllocator::create(Type type, bool pooled, int numaNodeId,
+                                                         std::shared_ptr<MKLDNNMemoryStatistics> statistics,
+                                                         size_t poolLimit) {
+    if (!statistics)
+        statistics = std::make_shared<MKLDNNMemoryStatistics>();
+#if defined(__linux__)
+    if (type == Type::HugePages)
+        return std::make_shared<HugePagesMemoryAllocator>(pooled, poolLimit, numaNodeId, std::move(statistics));
+#endif
+    // huge pages on other platforms require privileges the application usually doesn't have
+    return std::make_shared<DefaultMemoryAllocator>(pooled, poolLimit, std::move(statistics));
+}
+
+MKLDNNMemoryAllocator::MKLDNNMemoryAllocator(Type type, bool pooled, size_t poolLimit,
+                                             std::shared_ptr<MKLDNNMemoryStatistics> statistics)
+    : type(type), pooled(pooled), poolLimit(poolLimit), statistics(std::move(statistics)) {}
+
+MKLDNNMemoryAllocator::~MKLDNNMemoryAllocator() = default;
+
+size_t MKLDNNMemoryAllocator::blockSize(size_t size) const {
+    // page granularity gives pooled blocks more chances to be reused by allocations of a bit different sizes
+    return roundUp(size, pooled && size >= pageSize ? pageSize : alignment);
+}
+
+std::shared_ptr<void> MKLDNNMemoryAllocator::allocate(size_t size, MemoryCategory category) {
+    size_t block = blockSize(size == 0 ? 1 : size);
+
+    void* ptr = nullptr;
+    if (pooled) {
+        std::lock_guard<std::mutex> lock(poolGuard);
+        auto found = pool.lower_bound(block);
+        if (found != pool.end() && found->first / maxReuseFactor <= block) {
+            // the block keeps its size, so it is accounted and freed as a whole
+            block = found->first;
+            ptr = found->second;
+            pool.erase(found);
+            pooledSize -= block;
+        }
+    }
+    if (ptr == nullptr)
+        ptr = allocateBlock(block);
+
+    statistics->add(category, block);
+    auto self = shared_from_this();
+    return std::shared_ptr<void>(ptr, [self, block, category](void* ptr) {
+        self->release(ptr, block, category);
+    });
+}
+
+void MKLDNNMemoryAllocator::releasePool() {
+    std::lock_guard<std::mutex> lock(poolGuard);
+    for (const auto& block : pool)
+        freeBlock(block.second, block.first);
+    pool.clear();
+    pooledSize = 0;
+}
+
+size_t MKLDNNMemoryAllocator::getPooledSize() const {
+    std::lock_guard<std::mutex> lock(poolGuard);
+    return pooledSize;
+}
+
+void MKLDNNMemoryAllocator::release(void* ptr, size_t size, MemoryCategory category) {
+    statistics->remove(category, size);
+    if (pooled) {
+        std::lock_guard<std::mutex> lock(poolGuard);
+        if (pooledSize + size <= poolLimit) {
+            pool.emplace(size, ptr);
+            pooledSize += size;
+            return;
+        }
+    }
+    freeBlock(ptr, size);
+}
+
+namespace {
+
+struct AllocationState {
+    MKLDNNMemoryAllocator::Ptr allocator;
+    MemoryCategory category = MemoryCategory::Scratchpad;
+};
+
+thread_local AllocationState currentState;
+
+}  // namespace
+
+MKLDNNMemoryAllocationScope::MKLDNNMemoryAllocationScope(const MKLDNNMemoryAllocator::Ptr& allocator,
+                                                         MemoryCategory category)
+    : prevAllocator(currentState.allocator), prevCategory(currentState.category) {
+    if (allocator)
+        currentState.allocator = allocator;
+    currentState.category = category;
+}
+
+MKLDNNMemoryAllocationScope::MKLDNNMemoryAllocationScope(MemoryCategory category)
+    : MKLDNNMemoryAllocationScope(nullptr, category) {}
+
+MKLDNNMemoryAllocationScope::~MKLDNNMemoryAllocationScope() {
+    currentState.allocator = std::move(prevAllocator);
+    currentState.category = prevCategory;
+}
+
+const MKLDNNMemoryAllocator::Ptr& MKLDNNMemoryAllocationScope::currentAllocator() {
+    return currentState.allocator;
+}
+
+MemoryCategory MKLDNNMemoryAllocationScope::currentCategory() {
+    return currentState.category;
+}
+
+}  // namespace MKLDNNPlugin
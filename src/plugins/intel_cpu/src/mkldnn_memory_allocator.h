@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+
+/**
+ * @file contains allocators of the buffers behind MKLDNNMemory objects.
+ *
+ * By default oneDNN allocates memory of every MKLDNNMemory object itself. When an allocator is set for the current
+ * thread by MKLDNNMemoryAllocationScope, MKLDNNMemory objects created in the scope take their buffers from it instead,
+ * so the way the memory is obtained (huge pages, NUMA binding, pooling) and the amount of memory of every category
+ * can be controlled per executable network.
+ */
+
+namespace MKLDNNPlugin {
+
+enum class MemoryCategory {
+    Weights,      // constants and reordered weights, live as long as the network
+    Activations,  // edges of the graph
+    Scratchpad,   // internal buffers of nodes
+};
+
+/**
+ * @brief Numbers of bytes allocated by an allocator per memory category.
+ * Is thread safe, the counters are updated by allocations of all streams of a network.
+ */
+class MKLDNNMemoryStatistics {
+public:
+    static constexpr size_t categoriesCount = 3;
+
+    MKLDNNMemoryStatistics();
+
+    void add(MemoryCategory category, size_t size);
+    void remove(MemoryCategory category, size_t size);
+
+    // bytes currently allocated
+    size_t allocated(MemoryCategory category) const;
+    // maximum of the allocated bytes
+    size_t peak(MemoryCategory category) const;
+    // number of allocations
+    size_t allocations(MemoryCategory category) const;
+
+    void dump(std::ostream& out) const;
+
+private:
+    struct Counters {
+        std::atomic<size_t> allocated;
+        std::atomic<size_t> peak;
+        std::atomic<size_t> allocations;
+    };
+
+    std::array<Counters, categoriesCount> counters;
+};
+
+/**
+ * @brief Base class of the allocators. Derived classes only get and release blocks of memory, while the base class
+ * accounts the allocated bytes and optionally keeps released blocks in a pool to reuse them for allocations of the
+ * same or a bit smaller size (reallocations of dynamic shapes, graphs of several streams). The pool is limited,
+ * released blocks which don't fit into it are freed, so the memory doesn't grow with the number of distinct shapes.
+ */
+class MKLDNNMemoryAllocator : public std::enable_shared_from_this<MKLDNNMemoryAllocator> {
+public:
+    using Ptr = std::shared_ptr<MKLDNNMemoryAllocator>;
+
+    enum class Type {
+        Default,    // aligned heap allocation
+        HugePages,  // 2 MB pages via mmap/madvise, bound to the NUMA node of the stream
+    };
+
+    static constexpr size_t alignment = 64;
+    static constexpr size_t defaultPoolLimit = 256 * 1024 * 1024;
+
+    /**
+     * @brief Creates an allocator of the type
+     * @param numaNodeId NUMA node the memory is bound to, a negative value means no binding
+     * @param statistics counters shared by the allocators of a network, a new instance is created if null
+     * @param poolLimit maximum number of bytes of the released blocks kept in the pool
+     */
+    static Ptr create(Type type, bool pooled, int numaNodeId,
+                      std::shared_ptr<MKLDNNMemoryStatistics> statistics = nullptr,
+                      size_t poolLimit = defaultPoolLimit);
+
+    virtual ~MKLDNNMemoryAllocator();
+
+    /**
+     * @brief Allocates at least size bytes aligned to the alignment.
+     * The memory is returned to the allocator when the last copy of the pointer is released,
+     * so the allocator lives as long as its memory.
+     */
+    std::shared_ptr<void> allocate(size_t size, MemoryCategory category);
+
+    Type getType() const {
+        return type;
+    }
+
+    const MKLDNNMemoryStatistics& getStatistics() const {
+        return *statistics;
+    }
+
+    // bytes of released blocks kept in the pool
+    size_t getPooledSize() const;
+
+protected:
+    MKLDNNMemoryAllocator(Type type, bool pooled, size_t poolLimit, std::shared_ptr<MKLDNNMemoryStatistics> statistics);
+
+    // size of the block an allocation of the size takes
+    virtual size_t blockSize(size_t size) const;
+    virtual void* allocateBlock(size_t size) = 0;
+    virtual void freeBlock(void* ptr, size_t size) = 0;
+    // frees the pooled blocks, must be called by the destructors of derived classes
+    void releasePool();
+
+private:
+    void release(void* ptr, size_t size, MemoryCategory category);
+
+    const Type type;
+    const bool pooled;
+    const size_t poolLimit;
+    std::shared_ptr<MKLDNNMemoryStatistics> statistics;
+
+    mutable std::mutex poolGuard;
+    // released blocks by their sizes, an allocation takes the smallest block it fits into
+    std::multimap<size_t, void*> pool;
+    size_t pooledSize = 0;
+};
+
+/**
+ * @brief Sets the allocator and the category of the MKLDNNMemory objects created by the current thread
+ * until the end of the scope. Scopes may be nested, the previous state is restored on destruction.
+ * MKLDNNMemory objects created outside of any scope with an allocator are allocated by oneDNN.
+ */
+class MKLDNNMemoryAllocationScope {
+public:
+    // null allocator keeps the allocator of the enclosing scope
+    MKLDNNMemoryAllocationScope(const MKLDNNMemoryAllocator::Ptr& allocator, MemoryCategory category);
+    explicit MKLDNNMemoryAllocationScope(MemoryCategory category);
+    ~MKLDNNMemoryAllocationScope();
+
+    MKLDNNMemoryAllocationScope(const MKLDNNMemoryAllocationScope&) = delete;
+    MKLDNNMemoryAllocationScope& operator=(const MKLDNNMemoryAllocationScope&) = delete;
+
+    static const MKLDNNMemoryAllocator::Ptr& currentAllocator();
+    static MemoryCategory currentCategory();
+
+private:
+    MKLDNNMemoryAllocator::Ptr prevAllocator;
+    MemoryCategory prevCategory;
+};
+
+}  // namespace MKLDNNPlugin
@@ -234,7 +234,7 @@ bool MKLDNNNode::isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const
 void MKLDNNNode::createPrimitive() {
     if (inputShapesDefined() && isExecutable()) {
         if (needPrepareParams()) {
-            prepareParams();
+            prepareParamsProfiled();
         }
         updateLastInputDims();
     }
@@ -524,13 +524,21 @@ void MKLDNNNode::executeDynamic(mkldnn::stream strm) {
         if (needPrepareParams()) {
             IE_ASSERT(inputShapesDefined()) << "Can't prepare params for " << getTypeStr() << " node with name: " << getName() <<
                 " since the input shapes are not defined.";
-            prepareParams();
+            prepareParamsProfiled();
         }
         executeDynamicImpl(strm);
     }
     updateLastInputDims();
 }
 
+void MKLDNNNode::prepareParamsProfiled() {
+    const auto start = std::chrono::high_resolution_clock::now();
+    const size_t missesBefore = rtParamsCache ? rtParamsCache->getMissesCount() : 0;
+    prepareParams();
+    const size_t missesAfter = rtParamsCache ? rtParamsCache->getMissesCount() : 0;
+    perfCounter.addPrepareParams(start, static_cast<uint32_t>(missesAfter - missesBefore));
+}
+
 void MKLDNNNode::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) {
     if (newOutputShapes.size() != outputShapes.size()) {
         IE_THROW() << "Number shapes mismatch with real outputs number for node with name: " << getName();
@@ -752,6 +760,7 @@ void MKLDNNNode::prepareMemory(mkldnn::primitive_desc_iterator& itpd) {
 
         auto create = [&] () {
             // TODO [DS]: internal blobs should be removed or rewritten using Memory object
+            MKLDNNMemoryAllocationScope scope(MemoryCategory::Weights);
             auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
             MKLDNNMemory memory{ engine };
@@ -1043,12 +1052,17 @@ void MKLDNNNode::setDynamicBatchLim(int lim) {
     auto setDynamicBatch = [this](int argType, int newBatch) {
         auto param = primArgs.find(argType);
         if (param != primArgs.end()) {
-            auto oldMem = param->second;
-            mkldnn::memory::desc newMemDesc(oldMem.get_desc());
+            // memory object of the max batch shares data handle with the edge memory, so it's kept
+            // to restore it for the max batch and to get the actual data handle for reduced batches
+            auto fullMem = dynBatchFullArgs.emplace(argType, param->second).first->second;
+            if (newBatch == static_cast<int>(getMaxBatch())) {
+                param->second = fullMem;
+                return;
+            }
+            mkldnn::memory::desc newMemDesc(fullMem.get_desc());
             newMemDesc.data.dims[0] = newBatch;
             newMemDesc.data.padded_dims[0] = newBatch;
-            mkldnn::memory newMem(newMemDesc, oldMem.get_engine(), oldMem.get_data_handle());
-            primArgs.at(argType) = newMem;
+            param->second = mkldnn::memory(newMemDesc, fullMem.get_engine(), fullMem.get_data_handle());
         }
     };
 
@@ -662,6 +662,8 @@ protected:
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<NodeDesc> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
+    // primArgs memory objects of the max batch replaced by setDynamicBatchLim()
+    std::unordered_map<int, mkldnn::memory> dynBatchFullArgs;
     std::vector<MKLDNNMemoryPtr> binaryPostOpsArgs;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
@@ -765,6 +767,10 @@ protected:
     }
 
     virtual bool needPrepareParams() const;
+    /**
+     * @brief Calls prepareParams() and accounts its duration and runtime cache misses in the node performance counter
+     */
+    void prepareParamsProfiled();
     // TODO [mandrono]: add description
     // called after memory allocation/reallocation
     virtual void prepareParams() {
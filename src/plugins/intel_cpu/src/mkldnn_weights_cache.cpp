@@ -6,9 +6,22 @@
 
 #include <ie_system_conf.h>
 #include <memory>
+#include <string>
 
 namespace MKLDNNPlugin {
 
+namespace {
+
+// weights placed by different kinds of allocators (huge pages, heap) are not shared between networks
+std::string allocatorKey(const std::string& key) {
+    const auto& allocator = MKLDNNMemoryAllocationScope::currentAllocator();
+    if (!allocator)
+        return key;
+    return std::to_string(static_cast<int>(allocator->getType())) + "_" + key;
+}
+
+}  // namespace
+
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::MKLDNNSharedMemory(
@@ -36,17 +49,19 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
                             const std::string& key,
                             std::function<MKLDNNMemoryPtr(void)> create,
                             bool valid) {
+    const auto cacheKey = allocatorKey(key);
     std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
+    auto found = sharedWeights.find(cacheKey);
 
     MKLDNNMemoryInfo::Ptr ptr;
     MKLDNNMemoryPtr newPtr;
 
     if (found == sharedWeights.end()
         || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+        MKLDNNMemoryAllocationScope scope(MemoryCategory::Weights);
         newPtr = create();
         ptr = std::make_shared<MKLDNNMemoryInfo>(newPtr, valid);
-        sharedWeights[key] = ptr;
+        sharedWeights[cacheKey] = ptr;
     }
 
     return std::make_shared<MKLDNNSharedMemory>(ptr->valid.load(std::memory_order_relaxed)
@@ -55,8 +70,9 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::findOrCreate
 }
 
 MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const std::string& key) const {
+    const auto cacheKey = allocatorKey(key);
     std::unique_lock<std::mutex> lock(guard);
-    auto found = sharedWeights.find(key);
+    auto found = sharedWeights.find(cacheKey);
 
     MKLDNNMemoryInfo::Ptr ptr;
     MKLDNNMemoryPtr newPtr;
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "disable_gather_convert_folding.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::DisableGatherConvertFolding, "DisableGatherConvertFolding", 0);
+
+MKLDNNPlugin::DisableGatherConvertFolding::DisableGatherConvertFolding() {
+    auto table = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ngraph::element::i8, ngraph::element::u8}));
+    auto convert = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({table}, ngraph::pattern::consumers_count(1));
+    auto gather = ngraph::pattern::wrap_type<ngraph::opset1::Gather, ngraph::op::v7::Gather, ngraph::opset8::Gather>(
+        {convert, ngraph::pattern::any_input(), ngraph::pattern::wrap_type<ngraph::opset1::Constant>()});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& convertNode = m.get_pattern_value_map().at(convert).get_node_shared_ptr();
+        const auto& dstType = convertNode->get_output_element_type(0);
+        if (dstType != ngraph::element::f32 && dstType != ngraph::element::bf16)
+            return false;
+        ov::disable_constant_folding(convertNode);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(gather, "DisableGatherConvertFolding");
+    this->register_matcher(m, callback);
+}
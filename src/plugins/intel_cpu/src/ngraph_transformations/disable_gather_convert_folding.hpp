@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Keeps int8 Constant -> Convert(f32/bf16) -> Gather(data) unfolded,
+ * so the table stays compressed in memory and the Convert is fused into Gather,
+ * which dequantizes only the gathered rows.
+ */
+class DisableGatherConvertFolding: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DisableGatherConvertFolding();
+};
+
+}  // namespace MKLDNNPlugin
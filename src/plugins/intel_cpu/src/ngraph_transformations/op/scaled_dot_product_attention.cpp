@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& queries,
+                                                                           const ngraph::Output<Node>& keys,
+                                                                           const ngraph::Output<Node>& values,
+                                                                           const float scale,
+                                                                           const bool keys_transposed)
+    : Op({queries, keys, values}), m_scale(scale), m_keys_transposed(keys_transposed) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node>& queries,
+                                                                           const ngraph::Output<Node>& keys,
+                                                                           const ngraph::Output<Node>& values,
+                                                                           const ngraph::Output<Node>& mask,
+                                                                           const float scale,
+                                                                           const bool keys_transposed)
+    : Op({queries, keys, values, mask}), m_scale(scale), m_keys_transposed(keys_transposed) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                             m_scale, m_keys_transposed);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                             new_args.at(3), m_scale, m_keys_transposed);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected: 3 or 4.");
+
+    const auto& queries_pshape = get_input_partial_shape(0);
+    const auto& values_pshape = get_input_partial_shape(2);
+
+    // Result shape: [B1, ..., Bn, Lq, Dv]
+    ngraph::PartialShape output_pshape = ngraph::PartialShape::dynamic();
+    if (queries_pshape.rank().is_static() && values_pshape.rank().is_static()) {
+        NODE_VALIDATION_CHECK(this,
+            queries_pshape.size() >= 2 && queries_pshape.size() == values_pshape.size(),
+            "Queries and values must have the same rank not less than 2.");
+
+        output_pshape = queries_pshape;
+        output_pshape[output_pshape.size() - 1] = values_pshape[values_pshape.size() - 1];
+    }
+
+    set_output_type(0, get_input_element_type(0), output_pshape);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("keys_transposed", m_keys_transposed);
+    return true;
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief softmax(scale * Q * K^T + mask) * V
+ * Q: [B1, ..., Bn, Lq, D], K: [B1, ..., Bn, Lk, D] or [B1, ..., Bn, D, Lk] if keys are transposed,
+ * V: [B1, ..., Bn, Lk, Dv], optional additive mask is broadcastable to [B1, ..., Bn, Lq, Lk].
+ * Output: [B1, ..., Bn, Lq, Dv]
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "cpu_plugin_opset");
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node> &queries,
+                                  const ngraph::Output<Node> &keys,
+                                  const ngraph::Output<Node> &values,
+                                  float scale,
+                                  bool keys_transposed);
+
+    ScaledDotProductAttentionNode(const ngraph::Output<Node> &queries,
+                                  const ngraph::Output<Node> &keys,
+                                  const ngraph::Output<Node> &values,
+                                  const ngraph::Output<Node> &mask,
+                                  float scale,
+                                  bool keys_transposed);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_keys_transposed() const { return m_keys_transposed; }
+
+private:
+    float m_scale = 1.f;
+    bool m_keys_transposed = false;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_fusion.hpp"
+#include "op/scaled_dot_product_attention.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// MatMul(Q, K) or MatMul(Q, K) scaled by Multiply/Divide
+bool isScoresBranch(const std::shared_ptr<ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::MatMul>(node))
+        return true;
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node) && !ngraph::is_type<ngraph::opset1::Divide>(node))
+        return false;
+    return ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_shared_ptr(0)) ||
+           ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_shared_ptr(1));
+}
+
+// The fused node does not broadcast batch dimensions of keys and values, so they must be equal to the queries ones
+// at runtime: either both are 1 or neither can be 1, the latter is enough since MatMul requires broadcastable dimensions
+bool isSameBatchDim(const ngraph::Dimension& queries, const ngraph::Dimension& other) {
+    const ngraph::Dimension one(1);
+    return (queries == one && other == one) || (queries.get_min_length() > 1 && other.get_min_length() > 1);
+}
+
+// The mask may be broadcasted to the scores, but must not broadcast them
+bool isScoresDimKept(const ngraph::Dimension& scores, const ngraph::Dimension& mask) {
+    return mask == ngraph::Dimension(1) || scores.get_min_length() > 1;
+}
+
+int64_t getSoftmaxAxis(const std::shared_ptr<ngraph::Node>& node) {
+    if (const auto softmax = ngraph::as_type_ptr<ngraph::opset1::Softmax>(node))
+        return static_cast<int64_t>(softmax->get_axis());
+    if (const auto softmax = ngraph::as_type_ptr<ngraph::opset8::Softmax>(node))
+        return softmax->get_axis();
+    return 0;
+}
+
+}  // namespace
+
+MKLDNNPlugin::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(ngraph::pattern::has_static_rank());
+    auto values = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({softmax, values});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto outMatMul = ngraph::as_type_ptr<ngraph::opset1::MatMul>(m.get_match_root());
+        const auto softmaxNode = pattern_map.at(softmax).get_node_shared_ptr();
+        if (!outMatMul || outMatMul->get_transpose_a() || outMatMul->get_transpose_b() || !hasSingleConsumer(softmaxNode))
+            return false;
+
+        const auto rank = softmaxNode->get_output_partial_shape(0).rank().get_length();
+        auto axis = getSoftmaxAxis(softmaxNode);
+        if (axis < 0)
+            axis += rank;
+        if (rank < 2 || axis != rank - 1)
+            return false;
+
+        ngraph::NodeVector fusedNodes{outMatMul, softmaxNode};
+        auto scores = softmaxNode->get_input_node_shared_ptr(0);
+
+        // additive mask, the scores branch is the one which leads to the MatMul
+        ngraph::Output<ngraph::Node> mask;
+        std::shared_ptr<ngraph::Node> maskAdd;
+        if (ngraph::is_type<ngraph::opset1::Add>(scores) && hasSingleConsumer(scores)) {
+            for (size_t i = 0; i < 2; i++) {
+                const auto parent = scores->get_input_node_shared_ptr(i);
+                if (isScoresBranch(parent) && hasSingleConsumer(parent)) {
+                    mask = scores->input_value(1 - i);
+                    maskAdd = scores;
+                    fusedNodes.push_back(scores);
+                    scores = parent;
+                    break;
+                }
+            }
+            if (!mask.get_node())
+                return false;
+            const auto& maskRank = mask.get_partial_shape().rank();
+            if (maskRank.is_dynamic() || maskRank.get_length() > rank || mask.get_element_type() != scores->get_output_element_type(0))
+                return false;
+        }
+
+        // scalar scale of the scores
+        float scale = 1.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(scores) || ngraph::is_type<ngraph::opset1::Divide>(scores)) && hasSingleConsumer(scores)) {
+            const bool isDivide = ngraph::is_type<ngraph::opset1::Divide>(scores);
+            std::shared_ptr<ngraph::opset1::Constant> scaleNode;
+            std::shared_ptr<ngraph::Node> parent;
+            for (size_t i = 0; i < 2 && !scaleNode; i++) {
+                scaleNode = ngraph::as_type_ptr<ngraph::opset1::Constant>(scores->get_input_node_shared_ptr(i));
+                parent = scores->get_input_node_shared_ptr(1 - i);
+                // the divisor must be the constant
+                if (isDivide && i == 0)
+                    scaleNode = nullptr;
+            }
+            if (!scaleNode || ngraph::shape_size(scaleNode->get_shape()) != 1 || !hasSingleConsumer(parent))
+                return false;
+            scale = scaleNode->cast_vector<float>()[0];
+            if (isDivide) {
+                if (scale == 0.f)
+                    return false;
+                scale = 1.f / scale;
+            }
+            fusedNodes.push_back(scores);
+            scores = parent;
+        }
+
+        const auto qkMatMul = ngraph::as_type_ptr<ngraph::opset1::MatMul>(scores);
+        if (!qkMatMul || qkMatMul->get_transpose_a() || !hasSingleConsumer(qkMatMul))
+            return false;
+        fusedNodes.push_back(qkMatMul);
+
+        const auto queries = qkMatMul->input_value(0);
+        const auto keys = qkMatMul->input_value(1);
+        const auto valuesOut = outMatMul->input_value(1);
+        // batch dimensions are not broadcasted by the fused node
+        for (const auto& input : {keys, valuesOut}) {
+            if (input.get_partial_shape().rank() != queries.get_partial_shape().rank() ||
+                input.get_element_type() != queries.get_element_type())
+                return false;
+        }
+        const auto& queriesShape = queries.get_partial_shape();
+        if (queriesShape.rank() != rank)
+            return false;
+        for (int64_t i = 0; i < rank - 2; i++) {
+            if (!isSameBatchDim(queriesShape[i], keys.get_partial_shape()[i]) ||
+                !isSameBatchDim(queriesShape[i], valuesOut.get_partial_shape()[i]))
+                return false;
+        }
+        if (maskAdd) {
+            const auto& scoresShape = qkMatMul->get_output_partial_shape(0);
+            const auto& maskShape = mask.get_partial_shape();
+            if (scoresShape.rank() != rank || maskAdd->get_output_partial_shape(0) != scoresShape)
+                return false;
+            const int64_t maskOffset = rank - maskShape.rank().get_length();
+            for (int64_t i = maskOffset; i < rank; i++) {
+                if (!isScoresDimKept(scoresShape[i], maskShape[i - maskOffset]))
+                    return false;
+            }
+        }
+        const auto& type = queries.get_element_type();
+        if (type != ngraph::element::f32 && type != ngraph::element::bf16)
+            return false;
+
+        std::shared_ptr<ngraph::Node> attention;
+        if (mask.get_node()) {
+            attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(queries, keys, valuesOut, mask, scale,
+                                                                                      !qkMatMul->get_transpose_b());
+        } else {
+            attention = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(queries, keys, valuesOut, scale,
+                                                                                      !qkMatMul->get_transpose_b());
+        }
+        attention->set_friendly_name(outMatMul->get_friendly_name());
+        ngraph::copy_runtime_info(fusedNodes, attention);
+        ngraph::replace_node(outMatMul, attention);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "ScaledDotProductAttentionFusion");
+    this->register_matcher(m, callback);
+}
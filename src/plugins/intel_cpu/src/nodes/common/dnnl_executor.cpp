@@ -4,6 +4,8 @@
 
 #include "dnnl_executor.h"
 
+#include <cstring>
+
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 
@@ -18,9 +20,28 @@ void DnnlExecutor::IntermReorder::exec(mkldnn::memory& memSrc, mkldnn::memory& m
     m_reorder.execute(strm, memSrc, memDst);
 }
 
+mkldnn::memory DnnlExecutor::CachedReorder::get(IntermReorder& reorder, mkldnn::memory& memSrc, mkldnn::stream strm) {
+    const auto* srcData = static_cast<const uint8_t*>(memSrc.get_data_handle());
+    const size_t srcSize = memSrc.get_desc().get_size();
+    const bool isActual = static_cast<bool>(m_memDst) && srcData == m_lastSrcData &&
+                          (m_constSource || (srcSize == m_lastSrcCopy.size() && std::memcmp(srcData, m_lastSrcCopy.data(), srcSize) == 0));
+    if (!isActual) {
+        if (!m_memDst)
+            m_memDst = mkldnn::memory(reorder.getDstDesc(), strm.get_engine());
+        reorder.exec(memSrc, m_memDst, strm);
+        m_lastSrcData = srcData;
+        if (!m_constSource)
+            m_lastSrcCopy.assign(srcData, srcData + srcSize);
+    }
+    return m_memDst;
+}
+
 void DnnlExecutor::exec(std::unordered_map<int, mkldnn::memory> primArgs, mkldnn::stream strm) {
     for (auto &inReorder : inputReorders) {
-        if (primArgs.count(inReorder.first)) {
+        auto cached = cachedInputReorders.find(inReorder.first);
+        if (primArgs.count(inReorder.first) && cached != cachedInputReorders.end()) {
+            primArgs[inReorder.first] = cached->second.get(inReorder.second, primArgs[inReorder.first], strm);
+        } else if (primArgs.count(inReorder.first)) {
             mkldnn::memory memDst(inReorder.second.getDstDesc(), strm.get_engine());
             inReorder.second.exec(primArgs[inReorder.first], memDst, strm);
             primArgs[inReorder.first] = memDst;
@@ -24,6 +24,22 @@ class DnnlExecutor {
                 mkldnn::memory::desc m_descDst;
         };
 
+        /**
+         * Keeps the result of an input reorder and repeats the reorder only when the source memory
+         * or its content changes. Content of non-constant sources is compared with a copy of the last one.
+         */
+        class CachedReorder {
+            public:
+                explicit CachedReorder(bool constSource) : m_constSource(constSource) {}
+                mkldnn::memory get(IntermReorder& reorder, mkldnn::memory& memSrc, mkldnn::stream strm);
+
+            private:
+                bool m_constSource;
+                const void* m_lastSrcData = nullptr;
+                std::vector<uint8_t> m_lastSrcCopy;
+                mkldnn::memory m_memDst;
+        };
+
     public:
         void exec(std::unordered_map<int, mkldnn::memory> primArgs, mkldnn::stream strm);
         virtual ~DnnlExecutor() = default;
@@ -34,6 +50,8 @@ class DnnlExecutor {
         // key is the port number for the primitive that needs memory reordering
         std::unordered_map<int, IntermReorder> inputReorders;
         std::unordered_map<int, IntermReorder> outputReorders;
+        // inputs whose reordered memory is reused between executions
+        std::unordered_map<int, CachedReorder> cachedInputReorders;
 };
 
 }  // namespace MKLDNNPlugin
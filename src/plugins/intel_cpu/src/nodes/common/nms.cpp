@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms.h"
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+namespace nms {
+
+namespace {
+
+// kept boxes are checked in blocks, the inner loop over a block has no early exit and is vectorized
+constexpr size_t blockSize = 16;
+constexpr size_t maskBits = 64;
+// the mask takes num * num / 8 bytes, larger sets are processed by the greedy search
+constexpr size_t maxMaskBoxes = 8192;
+
+// Only selects of values computed anyway and min/max are used, so the loops calling it have no control flow and are vectorized.
+// Zero or negative extents give zero intersection, which covers the checks of the box areas as well.
+template <bool TouchRequired>
+inline float overlap(const Box& box, const BoxSet& boxes, const size_t j, const float offset) {
+    const float rawWidth = (std::min)(box.x1, boxes.x1()[j]) - (std::max)(box.x0, boxes.x0()[j]);
+    const float rawHeight = (std::min)(box.y1, boxes.y1()[j]) - (std::max)(box.y0, boxes.y0()[j]);
+
+    // if touching is required, the boxes with not intersecting coordinate ranges get zero extent whatever the offset is
+    const float width = TouchRequired ? (rawWidth >= 0.f ? rawWidth : -offset) + offset : (std::max)(rawWidth + offset, 0.f);
+    const float height = TouchRequired ? (rawHeight >= 0.f ? rawHeight : -offset) + offset : (std::max)(rawHeight + offset, 0.f);
+
+    const float intersection = width * height;
+    return intersection / (std::max)(box.area + boxes.area()[j] - intersection, std::numeric_limits<float>::min());
+}
+
+template <bool TouchRequired>
+void overlapRow(const Box& box, const BoxSet& boxes, const size_t begin, const size_t end, const float offset, float* iou) {
+    for (size_t j = begin; j < end; j++)
+        iou[j - begin] = overlap<TouchRequired>(box, boxes, j, offset);
+}
+
+template <bool Inclusive, bool TouchRequired>
+bool suppressedBy(const Box& box, const BoxSet& kept, const float threshold, const float offset) {
+    const size_t num = kept.size();
+    for (size_t begin = 0; begin < num; begin += blockSize) {
+        const size_t end = (std::min)(begin + blockSize, num);
+        int suppressed = 0;
+        for (size_t k = begin; k < end; k++) {
+            const float iou = overlap<TouchRequired>(box, kept, k, offset);
+            suppressed |= static_cast<int>(Inclusive ? iou >= threshold : iou > threshold);
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace
+
+void BoxSet::reserve(size_t capacity) {
+    if (capacity <= cap)
+        return;
+
+    std::vector<float> newData(5 * capacity);
+    for (size_t plane = 0; plane < 5; plane++) {
+        std::copy(data.begin() + plane * cap, data.begin() + plane * cap + count, newData.begin() + plane * capacity);
+    }
+    data.swap(newData);
+    cap = capacity;
+}
+
+void BoxSet::assign(const float* x0, const float* y0, const float* x1, const float* y1, size_t num, float offset) {
+    clear();
+    resize(num);
+    float* dst = data.data();
+    for (size_t i = 0; i < num; i++) {
+        dst[i] = x0[i];
+        dst[cap + i] = y0[i];
+        dst[2 * cap + i] = x1[i];
+        dst[3 * cap + i] = y1[i];
+        dst[4 * cap + i] = boxArea(x0[i], y0[i], x1[i], y1[i], offset);
+    }
+}
+
+void intersectionOverUnion(const Box& box, const BoxSet& boxes, size_t begin, size_t end, const IoUParams& params, float* iou) {
+    if (params.touchRequired)
+        overlapRow<true>(box, boxes, begin, end, params.offset, iou);
+    else
+        overlapRow<false>(box, boxes, begin, end, params.offset, iou);
+}
+
+bool isSuppressed(const Box& box, const BoxSet& kept, const SuppressParams& params) {
+    const float offset = params.iou.offset;
+    if (params.inclusive) {
+        return params.iou.touchRequired ? suppressedBy<true, true>(box, kept, params.threshold, offset)
+                                        : suppressedBy<true, false>(box, kept, params.threshold, offset);
+    }
+    return params.iou.touchRequired ? suppressedBy<false, true>(box, kept, params.threshold, offset)
+                                    : suppressedBy<false, false>(box, kept, params.threshold, offset);
+}
+
+size_t suppressSorted(const BoxSet& boxes, size_t maxOut, const SuppressParams& params, int* kept) {
+    const size_t num = boxes.size();
+    BoxSet keptBoxes((std::min)(num, maxOut));
+
+    size_t count = 0;
+    for (size_t i = 0; i < num && count < maxOut; i++) {
+        const Box box = boxes.get(i);
+        if (!isSuppressed(box, keptBoxes, params)) {
+            keptBoxes.push_back(box);
+            kept[count++] = static_cast<int>(i);
+        }
+    }
+    return count;
+}
+
+size_t suppressSortedParallel(const BoxSet& boxes, size_t maxOut, const SuppressParams& params, int* kept) {
+    const size_t num = boxes.size();
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    // the greedy search compares a box with at most maxOut kept boxes, the mask compares all pairs, but in parallel
+    if (nthr == 1 || num > maxMaskBoxes || 2 * nthr * (std::min)(maxOut, num) < num)
+        return suppressSorted(boxes, maxOut, params, kept);
+
+    // bit j of the row i is set if the box i suppresses the box j, only the words after the diagonal are filled
+    const size_t words = (num + maskBits - 1) / maskBits;
+    std::unique_ptr<uint64_t[]> mask(new uint64_t[num * words]);
+
+    // rows are distributed in turn, since their lengths decrease
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        float iou[maskBits];
+        for (size_t i = ithr; i < num; i += nthr) {
+            const Box box = boxes.get(i);
+            uint64_t* row = mask.get() + i * words;
+            for (size_t w = (i + 1) / maskBits; w < words; w++) {
+                const size_t begin = (std::max)(w * maskBits, i + 1);
+                const size_t end = (std::min)((w + 1) * maskBits, num);
+                intersectionOverUnion(box, boxes, begin, end, params.iou, iou);
+
+                uint64_t bits = 0;
+                for (size_t j = begin; j < end; j++) {
+                    const bool suppressed = params.inclusive ? iou[j - begin] >= params.threshold : iou[j - begin] > params.threshold;
+                    bits |= static_cast<uint64_t>(suppressed) << (j - w * maskBits);
+                }
+                row[w] = bits;
+            }
+        }
+    });
+
+    std::vector<uint64_t> removed(words, 0);
+    size_t count = 0;
+    for (size_t i = 0; i < num && count < maxOut; i++) {
+        if ((removed[i / maskBits] >> (i % maskBits)) & 1)
+            continue;
+
+        kept[count++] = static_cast<int>(i);
+        const uint64_t* row = mask.get() + i * words;
+        for (size_t w = (i + 1) / maskBits; w < words; w++)
+            removed[w] |= row[w];
+    }
+    return count;
+}
+
+size_t selectTopK(const float* scores, size_t n, float threshold, bool inclusive, size_t k, std::vector<int>& indices) {
+    indices.clear();
+    for (size_t i = 0; i < n; i++) {
+        if (inclusive ? scores[i] >= threshold : scores[i] > threshold)
+            indices.push_back(static_cast<int>(i));
+    }
+
+    auto greater = [scores](int l, int r) {
+        return scores[l] > scores[r] || (scores[l] == scores[r] && l < r);
+    };
+    if (k < indices.size()) {
+        std::nth_element(indices.begin(), indices.begin() + k, indices.end(), greater);
+        indices.resize(k);
+    }
+    std::sort(indices.begin(), indices.end(), greater);
+    return indices.size();
+}
+
+}  // namespace nms
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MKLDNNPlugin {
+namespace nms {
+
+/**
+ * Rules of the boxes overlap computation, the NMS-family operations differ in them.
+ * For well-formed boxes the IoU is computed exactly as by every operation:
+ *   w = max(min(x1a, x1b) - max(x0a, x0b) + offset, 0), h is computed the same way,
+ *   IoU = w * h / (area_a + area_b - w * h).
+ */
+struct IoUParams {
+    float offset = 0.f;         // added to the box sides, 1 for not normalized (pixel) coordinates
+    bool touchRequired = true;  // the boxes do not overlap if their coordinate ranges do not intersect, whatever the offset is
+};
+
+/**
+ * Hard suppression rule: a box is suppressed by a kept box if their IoU is above
+ * (or equal to, if inclusive) the threshold
+ */
+struct SuppressParams {
+    float threshold = 0.f;
+    bool inclusive = false;
+    IoUParams iou;
+};
+
+struct Box {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float area;
+};
+
+inline float boxArea(const float x0, const float y0, const float x1, const float y1, const float offset) {
+    return (x1 - x0 + offset) * (y1 - y0 + offset);
+}
+
+/**
+ * Boxes stored as separate arrays of coordinates and areas, so a box is compared with a block of boxes
+ * by a branchless loop the compiler vectorizes.
+ */
+class BoxSet {
+public:
+    BoxSet() = default;
+    explicit BoxSet(size_t capacity) {
+        reserve(capacity);
+    }
+
+    void reserve(size_t capacity);
+    void resize(size_t size) {
+        reserve(size);
+        count = size;
+    }
+    void clear() {
+        count = 0;
+    }
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * Fills the set with boxes given as separate arrays of coordinates, the areas are computed with the offset
+     */
+    void assign(const float* x0, const float* y0, const float* x1, const float* y1, size_t num, float offset);
+
+    void set(size_t i, const Box& box) {
+        data[i] = box.x0;
+        data[cap + i] = box.y0;
+        data[2 * cap + i] = box.x1;
+        data[3 * cap + i] = box.y1;
+        data[4 * cap + i] = box.area;
+    }
+    void push_back(const Box& box) {
+        if (count == cap)
+            reserve(cap ? 2 * cap : 16);
+        set(count++, box);
+    }
+    Box get(size_t i) const {
+        return {x0()[i], y0()[i], x1()[i], y1()[i], area()[i]};
+    }
+
+    const float* x0() const {
+        return data.data();
+    }
+    const float* y0() const {
+        return data.data() + cap;
+    }
+    const float* x1() const {
+        return data.data() + 2 * cap;
+    }
+    const float* y1() const {
+        return data.data() + 3 * cap;
+    }
+    const float* area() const {
+        return data.data() + 4 * cap;
+    }
+
+private:
+    std::vector<float> data;
+    size_t cap = 0;
+    size_t count = 0;
+};
+
+/**
+ * Computes IoU of the box with boxes [begin, end) of the set, the result for the box j is stored to iou[j - begin]
+ */
+void intersectionOverUnion(const Box& box, const BoxSet& boxes, size_t begin, size_t end, const IoUParams& params, float* iou);
+
+/**
+ * Checks the box against all boxes of the set. The boxes are processed in blocks,
+ * the search stops at the first block containing a suppressing box.
+ */
+bool isSuppressed(const Box& box, const BoxSet& kept, const SuppressParams& params);
+
+/**
+ * Greedy hard NMS of boxes sorted by the score in the descending order: a box is kept if no one of the kept boxes suppresses it.
+ * Stores positions of the kept boxes in the set to 'kept' and returns their number (at most 'maxOut').
+ * Single threaded, intended to be called for every batch and class from a parallel loop.
+ */
+size_t suppressSorted(const BoxSet& boxes, size_t maxOut, const SuppressParams& params, int* kept);
+
+/**
+ * The same result as of suppressSorted() for a single large set of boxes. If many boxes may be kept,
+ * all pairwise suppressions are computed in parallel into a bit mask, then the mask is scanned sequentially.
+ */
+size_t suppressSortedParallel(const BoxSet& boxes, size_t maxOut, const SuppressParams& params, int* kept);
+
+/**
+ * Selects indices of at most k boxes with the score above (or equal to, if inclusive) the threshold.
+ * The indices are sorted by the score in the descending order, equal scores by the index in the ascending order.
+ * Only the selected indices are sorted, the rest are partitioned out in linear time.
+ */
+size_t selectTopK(const float* scores, size_t n, float threshold, bool inclusive, size_t k, std::vector<int>& indices);
+
+}  // namespace nms
+}  // namespace MKLDNNPlugin
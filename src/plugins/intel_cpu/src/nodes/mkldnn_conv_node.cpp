@@ -141,6 +141,8 @@ void MKLDNNConvolutionNode::getSupportedDescriptors() {
         return;
 
     withBiases = getOriginalInputsNumber() == 3;
+    // non-constant weights are taken in the plain layout and reordered by the node when they change
+    withConstWeights = getParentEdgeAt(1)->getParent()->isConstant();
 
     if (!implPriorities.empty()) {
         isPrimitivesPriorityDefined = true;
@@ -426,7 +428,9 @@ void MKLDNNConvolutionNode::initSupportedPrimitiveDescriptors() {
                     dataConfig.inPlace = -1;
                     dataConfig.constant = false;
                     auto desc = getSrcMemDesc(itpd, i);
-                    if (desc->getType() & MemoryDescType::Blocked && !isGrouped) {
+                    if (i == 1 && !withConstWeights) {
+                        dataConfig.desc = getPlainWeightsDesc(desc->getPrecision());
+                    } else if (desc->getType() & MemoryDescType::Blocked && !isGrouped) {
                         dataConfig.desc = desc->as<BlockedMemoryDesc>()->cloneWithUndefStridesAndOffset();
                     } else {
                         dataConfig.desc = std::move(desc);
@@ -641,6 +645,8 @@ void MKLDNNConvolutionNode::initDescriptor(const NodeConfig& config) {
                     dataConfig.inPlace = -1;
                     dataConfig.constant = false;
                     dataConfig.desc = getSrcMemDesc(itpd, j);
+                    if (j == 1 && !withConstWeights)
+                        dataConfig.desc = getPlainWeightsDesc(dataConfig.desc->getPrecision());
                     cfg.inConfs.push_back(dataConfig);
                 }
 
@@ -973,8 +979,16 @@ void MKLDNNConvolutionNode::prepareParams() {
         pAttrLocal = initPrimitiveAttr();
     }
 
+    auto wghDnnlDesc = weightMemoryDesc->getDnnlDesc();
+    if (!withConstWeights) {
+        // the primitive uses its preferred weights layout, the executor reorders the weights only when they change
+        wghDnnlDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(wghMemPtr->getStaticDims()),
+                                           wghMemPtr->GetDataType(),
+                                           memory::format_tag::any);
+    }
+
     std::shared_ptr<MKLDNNDescriptor> desc = createMkldnnConvDesc(inMemoryDesc->getDnnlDesc(),
-                                                                  weightMemoryDesc->getDnnlDesc(),
+                                                                  wghDnnlDesc,
                                                                   outMemoryDesc->getDnnlDesc(),
                                                                   biasDesc);
 
@@ -992,7 +1006,8 @@ void MKLDNNConvolutionNode::prepareParams() {
                                                             srcMemPtr->GetPrimitive().get_desc(),
                                                             wghMemPtr->GetPrimitive().get_desc(),
                                                             dstMemPtr->GetPrimitive().get_desc(),
-                                                            getEngine());
+                                                            getEngine(),
+                                                            withConstWeights);
             break;
         }
 
@@ -1014,7 +1029,8 @@ void MKLDNNConvolutionNode::prepareParams() {
                 execPtr = std::make_shared<ConvolutionExecutor>(prim_desc, srcMemPtr->GetPrimitive().get_desc(),
                                                                 wghMemPtr->GetPrimitive().get_desc(),
                                                                 dstMemPtr->GetPrimitive().get_desc(),
-                                                                getEngine());
+                                                                getEngine(),
+                                                                withConstWeights);
                 break;
             }
         }
@@ -1038,7 +1054,8 @@ MKLDNNConvolutionNode::ConvolutionExecutor::ConvolutionExecutor(const mkldnn::co
                                                                 const mkldnn::memory::desc& inMemDesc,
                                                                 const mkldnn::memory::desc& weightMemDesc,
                                                                 const mkldnn::memory::desc& outMemDesc,
-                                                                const mkldnn::engine& engine) {
+                                                                const mkldnn::engine& engine,
+                                                                bool constWeights) {
     execPrim.reset(new mkldnn::convolution_forward(pd));
 
     if (inMemDesc != pd.src_desc()) {
@@ -1047,6 +1064,7 @@ MKLDNNConvolutionNode::ConvolutionExecutor::ConvolutionExecutor(const mkldnn::co
 
     if (weightMemDesc != pd.weights_desc()) {
         inputReorders.insert({DNNL_ARG_WEIGHTS, IntermReorder(weightMemDesc, pd.weights_desc(), engine)});
+        cachedInputReorders.insert({DNNL_ARG_WEIGHTS, CachedReorder(constWeights)});
     }
 
     if (outMemDesc != pd.dst_desc()) {
@@ -1065,6 +1083,10 @@ void MKLDNNConvolutionNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+MemoryDescPtr MKLDNNConvolutionNode::getPlainWeightsDesc(InferenceEngine::Precision precision) const {
+    return std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(weightDims));
+}
+
 void MKLDNNConvolutionNode::updatePadding() {
     //update padding.
     if (isDynamicNode() && autoPadding) {
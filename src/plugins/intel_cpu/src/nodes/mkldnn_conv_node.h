@@ -74,7 +74,8 @@ private:
                                 const mkldnn::memory::desc& inMemDesc,
                                 const mkldnn::memory::desc& weightMemDesc,
                                 const mkldnn::memory::desc& outMemDesc,
-                                const mkldnn::engine& engine);
+                                const mkldnn::engine& engine,
+                                bool constWeights);
     };
 
     std::shared_ptr<MKLDNNDescriptor> createMkldnnConvDesc(const mkldnn::memory::desc& srcDesc,
@@ -104,10 +105,12 @@ private:
                              const mkldnn::memory::desc& outputDesc,
                              mkldnn::algorithm alg);
     void updatePadding();
+    MemoryDescPtr getPlainWeightsDesc(InferenceEngine::Precision precision) const;
 
     bool withBiases;
     bool withSum;
     bool withDWConv;
+    bool withConstWeights = true;
     bool isGrouped;
     bool isPrimitivesPriorityDefined = false;
     std::vector<size_t> stride;
@@ -9,6 +9,7 @@
 #include "mkldnn/ie_mkldnn.h"
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 #include "mkldnn_detection_output_node.h"
 
 using namespace mkldnn;
@@ -723,67 +724,24 @@ inline void MKLDNNDetectionOutputNode::topk(const int *indicesIn, int *indicesOu
                            ConfidenceComparatorDO(conf));
 }
 
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decodedBbox[idx1 * 4 + 0];
-    float ymin1 = decodedBbox[idx1 * 4 + 1];
-    float xmax1 = decodedBbox[idx1 * 4 + 2];
-    float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    float xmin2 = decodedBbox[idx2 * 4 + 0];
-    float ymin2 = decodedBbox[idx2 * 4 + 1];
-    float xmax2 = decodedBbox[idx2 * 4 + 2];
-    float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
-    }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
-}
-
 inline void MKLDNNDetectionOutputNode::NMSCF(int* indicesIn,
                                         int& detections,
                                         int* indicesOut,
                                         const float* bboxes,
                                         const float* boxSizes) {
     // nms for this class
-    int countIn = detections;
-    detections = 0;
+    const int countIn = detections;
+    nms::BoxSet sortedBoxes(countIn);
     for (int i = 0; i < countIn; ++i) {
-        const int prior = indicesIn[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indicesOut[detections] = prior;
-            detections++;
-        }
+        const float* box = bboxes + indicesIn[i] * 4;
+        sortedBoxes.push_back({box[0], box[1], box[2], box[3], boxSizes[indicesIn[i]]});
+    }
+
+    nms::SuppressParams params;
+    params.threshold = NMSThreshold;
+    detections = static_cast<int>(nms::suppressSorted(sortedBoxes, countIn, params, indicesOut));
+    for (int k = 0; k < detections; ++k) {
+        indicesOut[k] = indicesIn[indicesOut[k]];
     }
 }
 
@@ -793,37 +751,36 @@ inline void MKLDNNDetectionOutputNode::NMSMX(int* indicesIn,
                                     const float* bboxes,
                                     const float* sizes) {
     // Input is candidate for image, output is candidate for each class within image
-    int countIn = detections[0];
+    const int countIn = detections[0];
     detections[0] = 0;
 
+    // candidates of the image are split by classes keeping the order, then classes are processed independently
+    std::vector<nms::BoxSet> classBoxes(classesNum);
+    std::vector<std::vector<int>> classPriors(classesNum);
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
         const int prior = idx % priorsNum;
 
-        // nms within this class
-        int &ndetection = detections[cls];
-        int *pindices = indicesOut + cls * priorsNum;
+        const int boxIdx = isShareLoc ? prior : cls * priorsNum + prior;
+        const float* box = bboxes + boxIdx * 4;
+        classBoxes[cls].push_back({box[0], box[1], box[2], box[3], sizes[boxIdx]});
+        classPriors[cls].push_back(prior);
+    }
 
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
+    nms::SuppressParams params;
+    params.threshold = NMSThreshold;
+    parallel_for(classesNum, [&](int cls) {
+        if (classPriors[cls].empty())
+            return;
 
-        if (keep) {
-            pindices[ndetection++] = prior;
+        // nms within this class
+        int *pindices = indicesOut + cls * priorsNum;
+        detections[cls] = static_cast<int>(nms::suppressSorted(classBoxes[cls], classBoxes[cls].size(), params, pindices));
+        for (int k = 0; k < detections[cls]; ++k) {
+            pindices[k] = classPriors[cls][pindices[k]];
         }
-    }
+    });
 }
 
 inline void MKLDNNDetectionOutputNode::generateOutput(float* reorderedConfData, int* indicesData, int* detectionsData, float* decodedBboxesData,
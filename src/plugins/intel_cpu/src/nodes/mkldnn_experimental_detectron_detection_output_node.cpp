@@ -4,36 +4,14 @@
 
 #include <string>
 #include <vector>
+#include <numeric>
 
 #include <ngraph/op/experimental_detectron_detection_output.hpp>
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 #include "mkldnn_experimental_detectron_detection_output_node.h"
 
 
-struct Indexer {
-    const std::vector<int> dims_;
-    int total_{1};
-
-    explicit Indexer(const std::vector<int>& dims) : dims_(dims) {
-        total_ = 1;
-        for (size_t i = 0; i < dims_.size(); ++i) {
-            total_ *= dims_[i];
-        }
-    }
-
-    int operator()(const std::vector<int>& idx) const {
-        int flat_idx = 0;
-        assert(idx.size() == dims_.size());
-        for (size_t i = 0; i < dims_.size(); ++i) {
-            assert(0 <= idx[i] && idx[i] < dims_[i]);
-            flat_idx = flat_idx * dims_[i] + idx[i];
-        }
-        assert(flat_idx < total_);
-        return flat_idx;
-    }
-};
-
-
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
@@ -44,21 +22,17 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
                   const float img_H, const float img_W,
                   const float max_delta_log_wh,
                   float coordinates_offset) {
-    Indexer box_idx({rois_num, 4});
-    Indexer delta_idx({rois_num, classes_num, 4});
-    Indexer score_idx({rois_num, classes_num});
-
-    Indexer refined_box_idx({classes_num, rois_num, 4});
-    Indexer refined_score_idx({classes_num, rois_num});
-
-    for (int roi_idx = 0; roi_idx < rois_num; ++roi_idx) {
-        float x0 = boxes[box_idx({roi_idx, 0})];
-        float y0 = boxes[box_idx({roi_idx, 1})];
-        float x1 = boxes[box_idx({roi_idx, 2})];
-        float y1 = boxes[box_idx({roi_idx, 3})];
+    // boxes: [rois_num, 4], deltas: [rois_num, classes_num, 4], scores: [rois_num, classes_num]
+    // refined_boxes: [classes_num, rois_num, 4], refined_scores and refined_boxes_areas: [classes_num, rois_num]
+    parallel_for(rois_num, [&](int roi_idx) {
+        const float* box = boxes + roi_idx * 4;
+        float x0 = box[0];
+        float y0 = box[1];
+        float x1 = box[2];
+        float y1 = box[3];
 
         if (x1 - x0 <= 0 || y1 - y0 <= 0) {
-            continue;
+            return;
         }
 
         // width & height of box
@@ -69,10 +43,11 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
         const float ctr_y = y0 + 0.5f * hh;
 
         for (int class_idx = 1; class_idx < classes_num; ++class_idx) {
-            const float dx = deltas[delta_idx({roi_idx, class_idx, 0})] / weights[0];
-            const float dy = deltas[delta_idx({roi_idx, class_idx, 1})] / weights[1];
-            const float d_log_w = deltas[delta_idx({roi_idx, class_idx, 2})] / weights[2];
-            const float d_log_h = deltas[delta_idx({roi_idx, class_idx, 3})] / weights[3];
+            const float* delta = deltas + (roi_idx * classes_num + class_idx) * 4;
+            const float dx = delta[0] / weights[0];
+            const float dy = delta[1] / weights[1];
+            const float d_log_w = delta[2] / weights[2];
+            const float d_log_h = delta[3] / weights[3];
 
             // new center location according to deltas (dx, dy)
             const float pred_ctr_x = dx * ww + ctr_x;
@@ -98,16 +73,18 @@ void refine_boxes(const float* boxes, const float* deltas, const float* weights,
             const float box_w = x1_new - x0_new + coordinates_offset;
             const float box_h = y1_new - y0_new + coordinates_offset;
 
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 0})] = x0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 1})] = y0_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 2})] = x1_new;
-            refined_boxes[refined_box_idx({class_idx, roi_idx, 3})] = y1_new;
+            const int refined_idx = class_idx * rois_num + roi_idx;
+            float* refined_box = refined_boxes + refined_idx * 4;
+            refined_box[0] = x0_new;
+            refined_box[1] = y0_new;
+            refined_box[2] = x1_new;
+            refined_box[3] = y1_new;
 
-            refined_boxes_areas[refined_score_idx({class_idx, roi_idx})] = box_w * box_h;
+            refined_boxes_areas[refined_idx] = box_w * box_h;
 
-            refined_scores[refined_score_idx({class_idx, roi_idx})] = scores[score_idx({roi_idx, class_idx})];
+            refined_scores[refined_idx] = scores[roi_idx * classes_num + class_idx];
         }
-    }
+    });
 }
 
 template <typename T>
@@ -117,61 +94,9 @@ static bool SortScorePairDescend(const std::pair<float, T>& pair1,
 }
 
 
-struct ConfidenceComparator {
-    explicit ConfidenceComparator(const float* conf_data) : _conf_data(conf_data) {}
-
-    bool operator()(int idx1, int idx2) {
-        if (_conf_data[idx1] > _conf_data[idx2]) return true;
-        if (_conf_data[idx1] < _conf_data[idx2]) return false;
-        return idx1 < idx2;
-    }
-
-    const float* _conf_data;
-};
-
-static inline float JaccardOverlap(const float *decoded_bbox,
-                                   const float *bbox_sizes,
-                                   const int idx1,
-                                   const int idx2,
-                                   const float coordinates_offset = 1) {
-    float xmin1 = decoded_bbox[idx1 * 4 + 0];
-    float ymin1 = decoded_bbox[idx1 * 4 + 1];
-    float xmax1 = decoded_bbox[idx1 * 4 + 2];
-    float ymax1 = decoded_bbox[idx1 * 4 + 3];
-
-    float xmin2 = decoded_bbox[idx2 * 4 + 0];
-    float ymin2 = decoded_bbox[idx2 * 4 + 1];
-    float ymax2 = decoded_bbox[idx2 * 4 + 3];
-    float xmax2 = decoded_bbox[idx2 * 4 + 2];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersect_xmin = (std::max)(xmin1, xmin2);
-    float intersect_ymin = (std::max)(ymin1, ymin2);
-    float intersect_xmax = (std::min)(xmax1, xmax2);
-    float intersect_ymax = (std::min)(ymax1, ymax2);
-
-    float intersect_width  = intersect_xmax - intersect_xmin + coordinates_offset;
-    float intersect_height = intersect_ymax - intersect_ymin + coordinates_offset;
-
-    if (intersect_width <= 0 || intersect_height <= 0) {
-        return 0.0f;
-    }
-
-    float intersect_size = intersect_width * intersect_height;
-    float bbox1_size = bbox_sizes[idx1];
-    float bbox2_size = bbox_sizes[idx2];
-
-    return intersect_size / (bbox1_size + bbox2_size - intersect_size);
-}
-
-
 static void nms_cf(const float* conf_data,
                    const float* bboxes,
                    const float* sizes,
-                   int* buffer,
                    int* indices,
                    int& detections,
                    const int boxes_num,
@@ -179,40 +104,27 @@ static void nms_cf(const float* conf_data,
                    const int post_nms_topn,
                    const float confidence_threshold,
                    const float nms_threshold) {
-    int count = 0;
-    for (int i = 0; i < boxes_num; ++i) {
-        if (conf_data[i] > confidence_threshold) {
-            indices[count] = i;
-            count++;
-        }
+    std::vector<int> candidates;
+    const size_t k = (pre_nms_topn == -1 ? boxes_num : pre_nms_topn);
+    const size_t num_candidates = nms::selectTopK(conf_data, boxes_num, confidence_threshold, false, k, candidates);
+
+    nms::BoxSet sorted_boxes(num_candidates);
+    for (const int idx : candidates) {
+        const float* box = bboxes + idx * 4;
+        sorted_boxes.push_back({box[0], box[1], box[2], box[3], sizes[idx]});
     }
 
-    int num_output_scores = (pre_nms_topn == -1 ? count : (std::min)(pre_nms_topn, count));
-
-    std::partial_sort_copy(indices, indices + count,
-                           buffer, buffer + num_output_scores,
-                           ConfidenceComparator(conf_data));
+    nms::SuppressParams params;
+    params.threshold = nms_threshold;
+    params.iou.offset = 1.0f;
+    params.iou.touchRequired = true;
 
-    detections = 0;
-    for (int i = 0; i < num_output_scores; ++i) {
-        const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indices[detections] = idx;
-            detections++;
-        }
+    // kept boxes are never suppressed by the later ones, so the search stops as soon as enough boxes are kept
+    const size_t max_detections = (post_nms_topn == -1 ? num_candidates : (std::min)(static_cast<size_t>(post_nms_topn), num_candidates));
+    detections = static_cast<int>(nms::suppressSorted(sorted_boxes, max_detections, params, indices));
+    for (int i = 0; i < detections; ++i) {
+        indices[i] = candidates[indices[i]];
     }
-
-    detections = (post_nms_topn == -1 ? detections : (std::min)(post_nms_topn, detections));
 }
 
 bool MKLDNNExperimentalDetectronDetectionOutputNode::needShapeInfer() const {
@@ -293,8 +205,6 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
     std::vector<float> refined_boxes(classes_num_ * rois_num * 4, 0);
     std::vector<float> refined_scores(classes_num_ * rois_num, 0);
     std::vector<float> refined_boxes_areas(classes_num_ * rois_num, 0);
-    Indexer refined_box_idx({classes_num_, rois_num, 4});
-    Indexer refined_score_idx({classes_num_, rois_num});
 
     refine_boxes(boxes, deltas, &deltas_weights_[0], scores,
                  &refined_boxes[0], &refined_boxes_areas[0], &refined_scores[0],
@@ -303,40 +213,37 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
                  max_delta_log_wh_,
                  1.0f);
 
-    // Apply NMS class-wise.
-    std::vector<int> buffer(rois_num, 0);
+    // Apply NMS class-wise. Classes are processed in parallel, each one uses its own slices of the buffers.
     std::vector<int> indices(classes_num_ * rois_num, 0);
     std::vector<int> detections_per_class(classes_num_, 0);
-    int total_detections_num = 0;
-
-    for (int class_idx = 1; class_idx < classes_num_; ++class_idx) {
-        nms_cf(&refined_scores[refined_score_idx({class_idx, 0})],
-               &refined_boxes[refined_box_idx({class_idx, 0, 0})],
-               &refined_boxes_areas[refined_score_idx({class_idx, 0})],
-               &buffer[0],
-               &indices[total_detections_num],
+
+    parallel_for(classes_num_ - 1, [&](int i) {
+        const int class_idx = i + 1;
+        nms_cf(&refined_scores[class_idx * rois_num],
+               &refined_boxes[class_idx * rois_num * 4],
+               &refined_boxes_areas[class_idx * rois_num],
+               &indices[class_idx * rois_num],
                detections_per_class[class_idx],
                rois_num,
                -1,
                max_detections_per_class_,
                score_threshold_,
                nms_threshold_);
-        total_detections_num += detections_per_class[class_idx];
-    }
+    });
 
     // Leave only max_detections_per_image_ detections.
     // confidence, <class, index>
     std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+    int total_detections_num = std::accumulate(detections_per_class.begin(), detections_per_class.end(), 0);
+    conf_index_class_map.reserve(total_detections_num);
 
-    int indices_offset = 0;
     for (int c = 0; c < classes_num_; ++c) {
         int n = detections_per_class[c];
         for (int i = 0; i < n; ++i) {
-            int idx = indices[indices_offset + i];
-            float score = refined_scores[refined_score_idx({c, idx})];
+            int idx = indices[c * rois_num + i];
+            float score = refined_scores[c * rois_num + idx];
             conf_index_class_map.push_back(std::make_pair(score, std::make_pair(c, idx)));
         }
-        indices_offset += n;
     }
 
     assert(max_detections_per_image_ > 0);
@@ -359,10 +266,11 @@ void MKLDNNExperimentalDetectronDetectionOutputNode::execute(mkldnn::stream strm
         float score = detection.first;
         int cls = detection.second.first;
         int idx = detection.second.second;
-        output_boxes[4 * i + 0] = refined_boxes[refined_box_idx({cls, idx, 0})];
-        output_boxes[4 * i + 1] = refined_boxes[refined_box_idx({cls, idx, 1})];
-        output_boxes[4 * i + 2] = refined_boxes[refined_box_idx({cls, idx, 2})];
-        output_boxes[4 * i + 3] = refined_boxes[refined_box_idx({cls, idx, 3})];
+        const float* refined_box = &refined_boxes[(cls * rois_num + idx) * 4];
+        output_boxes[4 * i + 0] = refined_box[0];
+        output_boxes[4 * i + 1] = refined_box[1];
+        output_boxes[4 * i + 2] = refined_box[2];
+        output_boxes[4 * i + 3] = refined_box[3];
         output_scores[i] = score;
         output_classes[i] = cls;
         ++i;
@@ -69,17 +69,17 @@ void MKLDNNExperimentalDetectronPriorGridGeneratorNode::execute(mkldnn::stream s
     const auto *bottom_data_0 = reinterpret_cast<const float *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     auto *top_data_0 = reinterpret_cast<float *>(getChildEdgesAtPort(OUTPUT_ROIS)[0]->getMemoryPtr()->GetPtr());
 
-    for (int h = 0; h < layer_height; ++h) {
-        for (int w = 0; w < layer_width; ++w) {
-            for (int s = 0; s < num_priors_; ++s) {
-                top_data_0[0] = bottom_data_0[4 * s + 0] + step_w * (w + 0.5f);
-                top_data_0[1] = bottom_data_0[4 * s + 1] + step_h * (h + 0.5f);
-                top_data_0[2] = bottom_data_0[4 * s + 2] + step_w * (w + 0.5f);
-                top_data_0[3] = bottom_data_0[4 * s + 3] + step_h * (h + 0.5f);
-                top_data_0 += 4;
-            }
+    parallel_for2d(layer_height, layer_width, [&](int h, int w) {
+        float* top_data = top_data_0 + (h * layer_width + w) * num_priors_ * 4;
+        const float shift_w = step_w * (w + 0.5f);
+        const float shift_h = step_h * (h + 0.5f);
+        for (int s = 0; s < num_priors_; ++s) {
+            top_data[4 * s + 0] = bottom_data_0[4 * s + 0] + shift_w;
+            top_data[4 * s + 1] = bottom_data_0[4 * s + 1] + shift_h;
+            top_data[4 * s + 2] = bottom_data_0[4 * s + 2] + shift_w;
+            top_data[4 * s + 3] = bottom_data_0[4 * s + 3] + shift_h;
         }
-    }
+    });
 }
 
 bool MKLDNNExperimentalDetectronPriorGridGeneratorNode::created() const {
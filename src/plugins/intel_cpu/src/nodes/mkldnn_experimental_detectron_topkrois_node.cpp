@@ -69,12 +69,14 @@ void MKLDNNExperimentalDetectronTopKROIsNode::execute(mkldnn::stream strm) {
 
     std::vector<size_t> idx(input_rois_num);
     iota(idx.begin(), idx.end(), 0);
-    // FIXME. partial_sort is enough here.
-    sort(idx.begin(), idx.end(), [&input_probs](size_t i1, size_t i2) {return input_probs[i1] > input_probs[i2];});
+    // only the top ROIs are ordered, equal probabilities keep the order of the input ROIs
+    std::partial_sort(idx.begin(), idx.begin() + top_rois_num, idx.end(), [&input_probs](size_t i1, size_t i2) {
+        return input_probs[i1] > input_probs[i2] || (input_probs[i1] == input_probs[i2] && i1 < i2);
+    });
 
-    for (int i = 0; i < top_rois_num; ++i) {
+    parallel_for(top_rois_num, [&](int i) {
         cpu_memcpy(output_rois + 4 * i, input_rois + 4 * idx[i], 4 * sizeof(float));
-    }
+    });
 }
 
 bool MKLDNNExperimentalDetectronTopKROIsNode::created() const {
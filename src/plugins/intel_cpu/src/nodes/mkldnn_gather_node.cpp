@@ -9,6 +9,8 @@
 #include "mkldnn_gather_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include <mkldnn_selective_build.h>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -16,8 +18,9 @@ using namespace InferenceEngine;
 bool MKLDNNGatherNode::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(),
-                ov::op::v7::Gather::get_type_info_static())) {
-            errorMessage = "Not supported Gather operation version. CPU plug-in supports only 7 version.";
+                ov::op::v7::Gather::get_type_info_static(),
+                ov::op::v8::Gather::get_type_info_static())) {
+            errorMessage = "Not supported Gather operation version. CPU plug-in supports only 7 and 8 versions.";
             return false;
         }
 
@@ -49,7 +52,7 @@ MKLDNNGatherNode::MKLDNNGatherNode(const std::shared_ptr<ov::Node>& op, const mk
     if (dataSrcRank == 0 || idxRank == 0)
         IE_THROW() << errorPrefix << "has incorrect input parameters ranks.";
 
-    batchDims = static_cast<int>(ov::as_type_ptr<ov::op::v7::Gather>(op)->get_batch_dims());
+    batchDims = static_cast<int>(ov::as_type_ptr<ov::op::util::GatherBase>(op)->get_batch_dims());
     if (batchDims < 0)
         batchDims += idxRank;
     if (batchDims < 0 || batchDims >= std::min(static_cast<int>(dataSrcRank), static_cast<int>(idxRank)))
@@ -63,7 +66,7 @@ MKLDNNGatherNode::MKLDNNGatherNode(const std::shared_ptr<ov::Node>& op, const mk
         if (axis < 0 || axis >= dataSrcRank || batchDims > axis)
             IE_THROW() << errorPrefix << "has incorrect input parameter axis value: " << axis;
     }
-    dataSize = getOriginalInputPrecisionAtPort(GATHER_DATA).size();
+    reverseIndexing = ov::is_type<ov::op::v8::Gather>(op);
 }
 
 void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
@@ -71,10 +74,16 @@ void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
         return;
 
     Precision dataPrecision = getOriginalInputPrecisionAtPort(GATHER_DATA);
+    // a fused Convert of an int8 table: only the gathered rows are dequantized
+    Precision outputPrecision = dataPrecision;
+    if (one_of(dataPrecision, Precision::I8, Precision::U8) &&
+            one_of(getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+        outputPrecision = getOriginalOutputPrecisionAtPort(0);
+
     addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                           {LayoutType::ncsp, Precision::I32},
                           {LayoutType::ncsp, Precision::I32, isAxisInputConst}},
-                         {{LayoutType::ncsp, dataPrecision}},
+                         {{LayoutType::ncsp, outputPrecision}},
                          impl_desc_type::ref_any);
 }
 
@@ -87,7 +96,9 @@ void MKLDNNGatherNode::prepareParams() {
 
     const auto& srcDims = srcMemPtr->getStaticDims();
     const auto& idxDims = getParentEdgeAt(GATHER_INDEXES)->getMemory().getStaticDims();
-    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    inPrecision = srcMemPtr->getDesc().getPrecision();
+    outPrecision = getChildEdgesAtPort(0)[0]->getMemory().getDesc().getPrecision();
+    dataSize = inPrecision.size();
 
     if (!isAxisInputConst) {
         axis = (reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_AXIS)->getMemoryPtr()->GetPtr()))[0];
@@ -103,7 +114,6 @@ void MKLDNNGatherNode::prepareParams() {
     dataLength = std::accumulate(srcDims.begin() + axis + 1, srcDims.end(), 1, std::multiplies<size_t>());
     srcBatchStride = std::accumulate(srcDims.begin() + batchDims, srcDims.end(), 1, std::multiplies<size_t>());
     idxBatchStride = std::accumulate(idxDims.begin() + batchDims, idxDims.end(), 1, std::multiplies<size_t>());
-    dstBatchStride = std::accumulate(dstDims.begin() + batchDims, dstDims.end(), 1, std::multiplies<size_t>());
     len = dataLength * dataSize;
     if (dataLength == 0)
         IE_THROW() << errorPrefix << "had incorrect input parameters dimension!";
@@ -116,30 +126,96 @@ bool MKLDNNGatherNode::needPrepareParams() const {
     return result;
 }
 
-void MKLDNNGatherNode::execute(mkldnn::stream strm) {
-    const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
-    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
-    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+template <typename F>
+void MKLDNNGatherNode::forEachRow(const uint8_t* srcData, const int32_t* srcIndexes, const F& copyRow) const {
+    // output rows are split evenly between threads, so a lookup with a single batch and outer slice
+    // (e.g. an embedding table) is parallel as well, and every thread writes a contiguous part of the output
+    const size_t rowsNum = batchSize * outerSize * idxBatchStride;
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(rowsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t j = start % idxBatchStride;
+        size_t k = (start / idxBatchStride) % outerSize;
+        size_t b = start / idxBatchStride / outerSize;
+        for (size_t row = start; row < end;) {
+            const uint8_t* srcSlice = srcData + (b * srcBatchStride + k * dataLength * indexRange) * dataSize;
+            const int32_t* sliceIndexes = srcIndexes + b * idxBatchStride;
+            for (; j < idxBatchStride && row < end; j++, row++) {
+                int32_t idx = sliceIndexes[j];
+                if (reverseIndexing && idx < 0)
+                    idx += static_cast<int32_t>(indexRange);
+                // out of range indices produce zero rows
+                copyRow(row, static_cast<uint32_t>(idx) < indexRange ? srcSlice + static_cast<size_t>(idx) * len : nullptr);
+            }
+            j = 0;
+            if (++k == outerSize) {
+                k = 0;
+                b++;
+            }
+        }
+    });
+}
 
-    parallel_for2d(batchSize, idxBatchStride, [&](const size_t i, const size_t j) {
-        const unsigned int idx = static_cast<uint32_t>(srcIndexes[i * idxBatchStride + j]);
+template <typename T>
+void MKLDNNGatherNode::gatherShortRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const {
+    T* dst = reinterpret_cast<T*>(dstData);
+    forEachRow(srcData, srcIndexes, [&](const size_t row, const uint8_t* srcRow) {
+        dst[row] = srcRow ? *reinterpret_cast<const T*>(srcRow) : T(0);
+    });
+}
 
-        // while negative indices are not supported, should set zero
-        if (idx < indexRange) {
-            for (size_t k = 0; k < outerSize; ++k) {
-                const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
-                const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
+void MKLDNNGatherNode::gatherLongRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const {
+    forEachRow(srcData, srcIndexes, [&](const size_t row, const uint8_t* srcRow) {
+        if (srcRow)
+            cpu_memcpy(dstData + row * len, srcRow, len);
+        else
+            memset(dstData + row * len, 0, len);
+    });
+}
 
-                cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
-            }
+template <typename srcType, typename dstType>
+void MKLDNNGatherNode::gatherConvertingRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const {
+    dstType* dst = reinterpret_cast<dstType*>(dstData);
+    forEachRow(srcData, srcIndexes, [&](const size_t row, const uint8_t* srcRow) {
+        dstType* dstRow = dst + row * dataLength;
+        if (srcRow) {
+            const srcType* src = reinterpret_cast<const srcType*>(srcRow);
+            for (size_t i = 0; i < dataLength; i++)
+                dstRow[i] = static_cast<dstType>(static_cast<float>(src[i]));
         } else {
-            for (size_t k = 0; k < outerSize; ++k) {
-                memset(&dstData[(i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize + j * len], 0, len);
-            }
+            std::fill(dstRow, dstRow + dataLength, static_cast<dstType>(0.0f));
         }
     });
 }
 
+void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    const int32_t* srcIndexes = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr()->GetPtr());
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    if (inPrecision != outPrecision) {
+        GatherContext ctx = { this, srcData, srcIndexes, dstData };
+        OV_SWITCH(MKLDNNPlugin, GatherConvertingExecute, ctx, std::tie(inPrecision, outPrecision),
+                  OV_CASE2(Precision::I8, Precision::FP32, int8_t, float),
+                  OV_CASE2(Precision::U8, Precision::FP32, uint8_t, float),
+                  OV_CASE2(Precision::I8, Precision::BF16, int8_t, bfloat16_t),
+                  OV_CASE2(Precision::U8, Precision::BF16, uint8_t, bfloat16_t));
+        return;
+    }
+
+    // rows of a single element (or a few small ones) are copied by typed loads instead of memcpy calls
+    switch (len) {
+        case 1: gatherShortRows<uint8_t>(srcData, srcIndexes, dstData); break;
+        case 2: gatherShortRows<uint16_t>(srcData, srcIndexes, dstData); break;
+        case 4: gatherShortRows<uint32_t>(srcData, srcIndexes, dstData); break;
+        case 8: gatherShortRows<uint64_t>(srcData, srcIndexes, dstData); break;
+        default: gatherLongRows(srcData, srcIndexes, dstData); break;
+    }
+}
+
 void MKLDNNGatherNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
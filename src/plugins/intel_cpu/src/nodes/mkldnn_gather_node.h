@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -29,8 +30,38 @@ protected:
     void prepareParams() override;
 
 private:
+    template <typename F>
+    void forEachRow(const uint8_t* srcData, const int32_t* srcIndexes, const F& copyRow) const;
+    template <typename T>
+    void gatherShortRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const;
+    void gatherLongRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const;
+    template <typename srcType, typename dstType>
+    void gatherConvertingRows(const uint8_t* srcData, const int32_t* srcIndexes, uint8_t* dstData) const;
+
+    struct GatherContext {
+        const MKLDNNGatherNode* node;
+        const uint8_t* srcData;
+        const int32_t* srcIndexes;
+        uint8_t* dstData;
+    };
+
+    template<typename T>
+    struct GatherConvertingExecute {
+        using srcType = typename std::tuple_element<0, T>::type;
+        using dstType = typename std::tuple_element<1, T>::type;
+
+        void operator()(GatherContext& ctx) {
+            ctx.node->gatherConvertingRows<srcType, dstType>(ctx.srcData, ctx.srcIndexes, ctx.dstData);
+        }
+    };
+
     int axis = 0;
     int batchDims = 0;
+    // Gather-8 counts negative indices from the end of the axis, Gather-7 fills zeros for them
+    bool reverseIndexing = false;
+    // data is converted to the output precision row by row if a Convert was fused into the node
+    InferenceEngine::Precision inPrecision;
+    InferenceEngine::Precision outPrecision;
 
     size_t indexRange = 0;
     size_t batchSize = 1;
@@ -38,7 +69,6 @@ private:
     size_t dataLength = 1;
     size_t srcBatchStride = 1;
     size_t idxBatchStride = 1;
-    size_t dstBatchStride = 1;
     size_t dataSize = 1;
     size_t len = 1;
     int dataSrcRank = 1;
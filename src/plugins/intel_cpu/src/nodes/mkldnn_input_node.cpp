@@ -253,6 +253,7 @@ void MKLDNNInputNode::cloneBlobIfRequired() {
     DnnlBlockedMemoryDesc memDesc(prec, shape);
 
     auto cloneBlob = [&, this] () {
+        MKLDNNMemoryAllocationScope scope(MemoryCategory::Weights);
         MKLDNNMemory memory{ getEngine() };
         memory.Create(memDesc, constOp->get_data_ptr());
 
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
 
@@ -145,59 +146,34 @@ static inline float boxArea(const float* bbox, const bool normalized) {
     }
 }
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+    std::vector<int32_t> candidateIndex;
+    const size_t topk = (m_nmsTopk > -1) ? static_cast<size_t>(m_nmsTopk) : static_cast<size_t>(m_numBoxes);
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    int64_t originalSize = static_cast<int64_t>(nms::selectTopK(scoresData, m_numBoxes, m_scoreThreshold, false, topk, candidateIndex));
     if (originalSize <= 0) {
         return 0;
     }
-    if (m_nmsTopk > -1 && originalSize > m_nmsTopk) {
-        originalSize = m_nmsTopk;
-    }
 
-    std::partial_sort(candidateIndex.begin(), candidateIndex.begin() + originalSize, end, [&scoresData](int32_t a, int32_t b) {
-        return scoresData[a] > scoresData[b];
-    });
+    nms::BoxSet candidateBoxes(originalSize);
+    for (const auto idx : candidateIndex) {
+        const float* box = boxesData + idx * 4;
+        candidateBoxes.push_back({box[0], box[1], box[2], box[3], boxArea(box, m_normalized)});
+    }
+    nms::IoUParams iouParams;
+    iouParams.offset = m_normalized ? 0.f : 1.f;
 
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
-        iouMax[actual_index] = max_iou;
+        float* iouRow = &iouMatrix[actual_index * (actual_index - 1) / 2];
+        nms::intersectionOverUnion(candidateBoxes.get(actual_index), candidateBoxes, 0, actual_index, iouParams, iouRow);
+        iouMax[actual_index] = *std::max_element(iouRow, iouRow + actual_index);
     });
 
     if (scoresData[candidateIndex[0]] > m_postThreshold) {
@@ -9,12 +9,12 @@
 #include <chrono>
 #include <cmath>
 #include <ie_ngraph_utils.hpp>
-#include <queue>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms.h"
 #include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
@@ -303,134 +303,93 @@ bool MKLDNNMultiClassNmsNode::created() const {
     return getType() == MulticlassNms;
 }
 
-float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    const float norm = static_cast<float>(normalized == false);
-
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+namespace {
+
+// boxes of the candidates in the order of the scores, the box coordinates are ymin, xmin, ymax, xmax
+nms::BoxSet sortedBoxes(const float* boxes, const std::vector<int>& indices, const float norm) {
+    nms::BoxSet sorted(indices.size());
+    for (const int idx : indices) {
+        const float* box = boxes + idx * 4;
+        sorted.push_back({box[0], box[1], box[2], box[3], nms::boxArea(box[0], box[1], box[2], box[3], norm)});
+    }
+    return sorted;
 }
 
-void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
-    auto less = [](const boxInfo& l, const boxInfo& r) {
-        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-    };
+}  // namespace
 
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0f : 0.0f;
-    };
+void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+    nms::SuppressParams params;
+    params.inclusive = true;
+    params.iou.offset = static_cast<float>(m_normalized == false);
+    params.iou.touchRequired = false;
 
+    // A candidate is never rescored: it is either suppressed by a box with IoU not less than the adaptive threshold,
+    // or selected with the original score. So the search is greedy, the threshold is decreased after every selected box.
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (class_idx != m_backgroundClass) {
-            std::vector<filteredBoxes> fb;
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            for (int box_idx = 0; box_idx < m_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-            }
-            fb.reserve(sorted_boxes.size());
-            if (sorted_boxes.size() > 0) {
-                auto adaptive_threshold = m_iouThreshold;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-                    max_out_box--;
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold)
-                            break;
+            std::vector<int> candidates;
+            nms::selectTopK(scoresPtr, m_numBoxes, m_scoreThreshold, true, m_nmsRealTopk, candidates);  // algin with ref
+            const nms::BoxSet candidateBoxes = sortedBoxes(boxesPtr, candidates, params.iou.offset);
+
+            nms::SuppressParams adaptiveParams = params;
+            adaptiveParams.threshold = m_iouThreshold;
+            nms::BoxSet keptBoxes(candidates.size());
+            size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+            size_t numKept = 0;
+            for (size_t i = 0; i < candidates.size(); i++) {
+                const nms::Box box = candidateBoxes.get(i);
+                bool suppressed = false;
+                if (scoresPtr[candidates[i]] <= m_scoreThreshold) {
+                    // to align with reference: the candidate with the score equal to the threshold is checked against the last selected box only
+                    if (numKept > 0) {
+                        float iou = 0.f;
+                        nms::intersectionOverUnion(box, keptBoxes, numKept - 1, numKept, adaptiveParams.iou, &iou);
+                        suppressed = iou >= adaptiveParams.threshold;
                     }
+                } else {
+                    suppressed = nms::isSuppressed(box, keptBoxes, adaptiveParams);
+                }
 
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
-                            adaptive_threshold *= m_nmsEta;
-                        }
-                        if (currBox.score == origScore) {
-                            fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
+                if (!suppressed) {
+                    if (m_nmsEta < 1 && adaptiveParams.threshold > 0.5) {
+                        adaptiveParams.threshold *= m_nmsEta;
                     }
+                    keptBoxes.push_back(box);
+                    m_filtBoxes[offset + numKept++] = filteredBoxes(scoresPtr[candidates[i]], batch_idx, class_idx, candidates[i]);
                 }
             }
-            m_numFiltBox[batch_idx][class_idx] = fb.size();
-            size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-            for (size_t i = 0; i < fb.size(); i++) {
-                m_filtBoxes[offset + i] = fb[i];
-            }
+            m_numFiltBox[batch_idx][class_idx] = numKept;
         }
     });
 }
 
 void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+    nms::SuppressParams params;
+    params.threshold = m_iouThreshold;
+    params.inclusive = true;
+    params.iou.offset = static_cast<float>(m_normalized == false);
+    params.iou.touchRequired = false;
+
     parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
         if (class_idx != m_backgroundClass) {
             const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::vector<std::pair<float, int>> sorted_boxes;
-            for (int box_idx = 0; box_idx < m_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // algin with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-            }
+            // only the first nms_top_k candidates are considered
+            std::vector<int> candidates;
+            nms::selectTopK(scoresPtr, m_numBoxes, m_scoreThreshold, true, m_nmsRealTopk, candidates);  // algin with ref
+            const nms::BoxSet candidateBoxes = sortedBoxes(boxesPtr, candidates, params.iou.offset);
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+            std::vector<int> kept(candidates.size());
+            const size_t io_selection_size = nms::suppressSorted(candidateBoxes, candidates.size(), params, kept.data());
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+            for (size_t i = 0; i < io_selection_size; i++) {
+                const int box_idx = candidates[kept[i]];
+                m_filtBoxes[offset + i] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
             }
             m_numFiltBox[batch_idx][class_idx] = io_selection_size;
         }
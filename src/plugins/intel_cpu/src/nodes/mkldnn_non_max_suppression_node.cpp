@@ -826,6 +826,24 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
+nms::Box MKLDNNNonMaxSuppressionNode::cornerBox(const float *box) const {
+    float ymin, xmin, ymax, xmax;
+    if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+        //  box format: x_center, y_center, width, height
+        ymin = box[1] - box[3] / 2.f;
+        xmin = box[0] - box[2] / 2.f;
+        ymax = box[1] + box[3] / 2.f;
+        xmax = box[0] + box[2] / 2.f;
+    } else {
+        //  box format: y1, x1, y2, x2
+        ymin = (std::min)(box[0], box[2]);
+        xmin = (std::min)(box[1], box[3]);
+        ymax = (std::max)(box[0], box[2]);
+        xmax = (std::max)(box[1], box[3]);
+    }
+    return {ymin, xmin, ymax, xmax, nms::boxArea(ymin, xmin, ymax, xmax, 0.f)};
+}
+
 float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
     float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
     if (boxEncodingType == NMSBoxEncodeType::CENTER) {
@@ -1045,22 +1063,22 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
                         }
                     }
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
-                            if (iou >= iouThreshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
+                    nms::BoxSet candidateBoxes(sortedBoxSize);
+                    for (const auto& candidate : sorted_boxes) {
+                        candidateBoxes.push_back(cornerBox(&boxesPtr[candidate.second * 4]));
+                    }
 
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
+                    nms::SuppressParams params;
+                    params.threshold = iouThreshold;
+                    params.inclusive = true;
+                    params.iou.touchRequired = false;
+
+                    // the first box is always kept and is already stored
+                    std::vector<int> kept(std::min(sortedBoxSize, maxOutputBoxesPerClass));
+                    io_selection_size = static_cast<int>(nms::suppressSorted(candidateBoxes, kept.size(), params, kept.data()));
+                    for (int selected_idx = 1; selected_idx < io_selection_size; selected_idx++) {
+                        const auto& candidate = sorted_boxes[kept[selected_idx]];
+                        filtBoxes[offset + selected_idx] = filteredBoxes(candidate.first, batch_idx, class_idx, candidate.second);
                     }
                 }
             }
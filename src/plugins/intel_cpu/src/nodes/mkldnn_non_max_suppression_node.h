@@ -10,6 +10,8 @@
 #include <memory>
 #include <vector>
 
+#include "common/nms.h"
+
 #define BOX_COORD_NUM 4
 
 using namespace InferenceEngine;
@@ -88,6 +90,7 @@ public:
     };
 
     float intersectionOverUnion(const float *boxesI, const float *boxesJ);
+    nms::Box cornerBox(const float *box) const;
 
     void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                           const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
@@ -16,6 +16,9 @@
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <ie_parallel.hpp>
+#include <limits>
+#include <numeric>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -123,8 +126,8 @@ std::shared_ptr<pooling_v2_forward::desc> createDescriptorHelper(const mkldnn::m
 bool MKLDNNPoolingNode::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (ov::is_type<const ov::op::v8::MaxPool>(op)) {
-            if (!op->get_output_target_inputs(1).empty()) {
-                errorMessage = "MaxPool from opset8 is supported only with one output";
+            if (!op->get_output_target_inputs(1).empty() && op->get_input_partial_shape(0).rank().is_dynamic()) {
+                errorMessage = "MaxPool from opset8 with indices output is supported only with static input rank";
                 return false;
             }
         } else if (!ov::is_type<const ov::op::v1::MaxPool>(op) && !ov::is_type<const ov::op::v1::AvgPool>(op)) {
@@ -162,6 +165,13 @@ MKLDNNPoolingNode::MKLDNNPoolingNode(const std::shared_ptr<ov::Node>& op, const
         get_attributes(data_pad_end, maxPoolOp_v8->get_pads_end());
 
         auto_pad = (maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_LOWER || maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_UPPER);
+
+        withIndices = !maxPoolOp_v8->get_output_target_inputs(1).empty();
+        if (withIndices) {
+            const auto axis = maxPoolOp_v8->get_axis();
+            const auto rank = maxPoolOp_v8->get_input_partial_shape(0).rank().get_length();
+            indicesAxis = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+        }
     } else if (auto maxPoolOp_v1 = ov::as_type_ptr<const ov::op::v1::MaxPool>(op)) {
         algorithm = PoolingMax;
         exclude_pad = false;
@@ -263,6 +273,9 @@ void MKLDNNPoolingNode::getSupportedDescriptors() {
     if ((inputRank < 3) || (inputRank > 5))
         IE_THROW() << "Pooling layer. Unsupported mode. Only 3D, 4D and 5D blobs are supported as input.";
 
+    if (withIndices)
+        return;
+
     initEffectiveAttributes(MemoryDescUtils::makeDummyShape(parentShape),
                             MemoryDescUtils::makeDummyShape(childShape));
 
@@ -302,6 +315,14 @@ void MKLDNNPoolingNode::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW()  << "Pooling node with name '" << getName() << "' did not set preferable primitive descriptor";
 
+    if (withIndices) {
+        if (isDynamicNode() && auto_pad) {
+            data_pad_begin = shapeInference->get_pads_begin();
+            data_pad_end = shapeInference->get_pads_end();
+        }
+        return;
+    }
+
     AttrPtr attr;
     if (isDynamicNode()) {
         if (!pAttr) {
@@ -376,10 +397,87 @@ void MKLDNNPoolingNode::prepareParams() {
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
 }
 
+void MKLDNNPoolingNode::execute(mkldnn::stream strm) {
+    if (withIndices) {
+        executeMaxPoolWithIndices();
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
 void MKLDNNPoolingNode::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
 
+void MKLDNNPoolingNode::executeMaxPoolWithIndices() {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto* src = reinterpret_cast<const float*>(srcMemory.GetPtr());
+    auto* dst = reinterpret_cast<float*>(dstMemory.GetPtr());
+    auto* indices = reinterpret_cast<int32_t*>(getChildEdgesAtPort(1)[0]->getMemory().GetPtr());
+
+    const auto& inDims = srcMemory.getStaticDims();
+    const auto& outDims = dstMemory.getStaticDims();
+
+    // 1D and 2D pooling are computed as 3D one with unit leading spatial dimensions
+    const size_t spatialOffset = 5 - inDims.size();
+    auto spatialDim = [&](const VectorDims& dims, size_t axis) {
+        return axis < spatialOffset ? ptrdiff_t(1) : static_cast<ptrdiff_t>(dims[2 + axis - spatialOffset]);
+    };
+    auto spatialAttr = [&](const std::vector<ptrdiff_t>& attr, size_t axis, ptrdiff_t defaultValue) {
+        return axis < spatialOffset ? defaultValue : attr[axis - spatialOffset];
+    };
+
+    const ptrdiff_t ID = spatialDim(inDims, 0), IH = spatialDim(inDims, 1), IW = spatialDim(inDims, 2);
+    const ptrdiff_t OD = spatialDim(outDims, 0), OH = spatialDim(outDims, 1), OW = spatialDim(outDims, 2);
+    const ptrdiff_t KD = spatialAttr(kernel, 0, 1), KH = spatialAttr(kernel, 1, 1), KW = spatialAttr(kernel, 2, 1);
+    const ptrdiff_t SD = spatialAttr(stride, 0, 1), SH = spatialAttr(stride, 1, 1), SW = spatialAttr(stride, 2, 1);
+    const ptrdiff_t DD = spatialAttr(dilation, 0, 1), DH = spatialAttr(dilation, 1, 1), DW = spatialAttr(dilation, 2, 1);
+    const ptrdiff_t PD = spatialAttr(data_pad_begin, 0, 0), PH = spatialAttr(data_pad_begin, 1, 0), PW = spatialAttr(data_pad_begin, 2, 0);
+
+    const size_t channels = inDims[0] * inDims[1];
+    const size_t inPlane = ID * IH * IW;
+    const size_t outPlane = OD * OH * OW;
+    const size_t indicesRange = std::accumulate(inDims.begin() + indicesAxis, inDims.end(), size_t(1), std::multiplies<size_t>());
+
+    parallel_for3d(channels, static_cast<size_t>(OD), static_cast<size_t>(OH), [&](size_t c, size_t od, size_t oh) {
+        const float* srcPlane = src + c * inPlane;
+        const size_t outOffset = c * outPlane + (od * OH + oh) * OW;
+
+        // the kernel positions in the padding area are skipped, so the window is clipped once per output row
+        const ptrdiff_t d0 = static_cast<ptrdiff_t>(od) * SD - PD, h0 = static_cast<ptrdiff_t>(oh) * SH - PH;
+        const ptrdiff_t kdBegin = d0 < 0 ? div_up(-d0, DD) : 0;
+        const ptrdiff_t kdEnd = std::min(KD, div_up(ID - d0, DD));
+        const ptrdiff_t khBegin = h0 < 0 ? div_up(-h0, DH) : 0;
+        const ptrdiff_t khEnd = std::min(KH, div_up(IH - h0, DH));
+
+        for (ptrdiff_t ow = 0; ow < OW; ow++) {
+            const ptrdiff_t w0 = ow * SW - PW;
+            const ptrdiff_t kwBegin = w0 < 0 ? div_up(-w0, DW) : 0;
+            const ptrdiff_t kwEnd = std::min(KW, div_up(IW - w0, DW));
+
+            float maxValue = std::numeric_limits<float>::lowest();
+            size_t maxIndex = 0;
+            for (ptrdiff_t kd = kdBegin; kd < kdEnd; kd++) {
+                for (ptrdiff_t kh = khBegin; kh < khEnd; kh++) {
+                    const size_t rowOffset = ((d0 + kd * DD) * IH + h0 + kh * DH) * IW + w0;
+                    for (ptrdiff_t kw = kwBegin; kw < kwEnd; kw++) {
+                        const size_t offset = rowOffset + kw * DW;
+                        // the first of equal maximums is taken, like in the reference implementation
+                        if (srcPlane[offset] > maxValue) {
+                            maxValue = srcPlane[offset];
+                            maxIndex = offset;
+                        }
+                    }
+                }
+            }
+
+            dst[outOffset + ow] = maxValue;
+            indices[outOffset + ow] = static_cast<int32_t>((c * inPlane + maxIndex) % indicesRange);
+        }
+    });
+}
+
 bool MKLDNNPoolingNode::created() const {
     return getType() == Pooling;
 }
@@ -453,6 +551,14 @@ void MKLDNNPoolingNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withIndices) {
+        addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32}},
+                             {{LayoutType::ncsp, Precision::FP32},
+                              {LayoutType::ncsp, Precision::I32}},
+                             impl_desc_type::ref_any);
+        return;
+    }
+
     mkldnn::primitive_attr attr;
     setPostOps(attr);
 
@@ -510,7 +616,8 @@ void MKLDNNPoolingNode::initDescriptor(const NodeConfig& config) {
     std::vector<MemoryDescPtr> outDescs;
     for (const auto& outConf : config.outConfs)
         outDescs.push_back(outConf.desc);
-    createDescriptor(inDescs, outDescs);
+    if (!withIndices)
+        createDescriptor(inDescs, outDescs);
 
     mkldnn::primitive_attr attr;
     setPostOps(attr);
@@ -28,6 +28,7 @@ public:
     }
 
     void prepareParams() override;
+    void execute(mkldnn::stream strm) override;
     void executeDynamicImpl(mkldnn::stream strm) override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
@@ -39,6 +40,7 @@ private:
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) const;
 
     void initEffectiveAttributes(const Shape &inDims, const Shape &outDims);
+    void executeMaxPoolWithIndices();
     mkldnn::algorithm getPoolingAlgorithm() const;
     std::shared_ptr<mkldnn::pooling_v2_forward::desc> createDescriptorInternal(const mkldnn::memory::desc& in_candidate,
                                                                                const mkldnn::memory::desc& out_candidate,
@@ -47,6 +49,10 @@ private:
     AttrPtr pAttr;
 
     bool isMaxPool8 = false;
+    /// MaxPool-8 with the consumed indices output is executed by the node itself, oneDNN has no such primitive
+    bool withIndices = false;
+    /// Indices are flat offsets in the input tensor counted from this dimension
+    size_t indicesAxis = 0;
     bool auto_pad = false;
     bool exclude_pad = false;
     std::vector<ptrdiff_t> dilation;
@@ -48,6 +48,10 @@ public:
         this->isOptimized = isOptimized;
     }
 
+    bool getOptimized() const {
+        return isOptimized;
+    }
+
     void setDynamicBatchLim(int lim) override;
 
     bool canBeInPlace() const override {
@@ -61,6 +65,11 @@ public:
 
     static void reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size = 0);
 
+    /**
+     * @brief Checks that oneDNN provides a reorder between the descriptors, including the precision conversion
+     */
+    static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng);
+
 private:
     std::shared_ptr<MemoryDesc> input;
     std::shared_ptr<MemoryDesc> output;
@@ -10,10 +10,15 @@
 #include "mkldnn_input_node.h"
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <ie_parallel.hpp>
 
 #include <ngraph/node.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <string>
 #include <utility>
 
@@ -181,26 +186,9 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
             return false;
         }
 
+        size_t wIdx = 3;
         if (one_of(op->get_type_info(), ov::op::v0::RNNCell::get_type_info_static(), ov::op::v3::GRUCell::get_type_info_static())) {
-            // Plug-in does not support dynamism on weights.
-            if (!ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(2)) ||
-                    !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(3)) ||
-                    (op->get_input_size() > 4 && !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(4)))) {
-                errorMessage = "Node expects constants as W, R, B inputs.";
-                return false;
-            }
-        } else if (one_of(op->get_type_info(),
-                ov::op::v0::LSTMCell::get_type_info_static(),
-                ov::op::v4::LSTMCell::get_type_info_static(),
-                ov::op::v5::GRUSequence::get_type_info_static(),
-                ov::op::v5::RNNSequence::get_type_info_static())) {
-            // Plug-in does not support dynamism on weights.
-            if (!ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(3)) ||
-                    !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(4)) ||
-                    (op->get_input_size() > 5 && !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(5)))) {
-                errorMessage = "Node expects constants as W, R, B inputs.";
-                return false;
-            }
+            wIdx = 2;
         } else if (one_of(op->get_type_info(),
                 ov::op::v0::LSTMSequence::get_type_info_static(),
                 ov::op::v5::LSTMSequence::get_type_info_static())) {
@@ -208,18 +196,19 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                 errorMessage = "Node expects 7 inputs. Actual: " + std::to_string(op->get_input_size());
                 return false;
             }
-            // Plug-in does not support dynamism on weights.
-            if (!ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(4)) ||
-                    !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(5)) ||
-                    !ov::is_type<ov::op::v0::Constant>(op->get_input_node_ptr(6))) {
-                errorMessage = "Node expects constants as W, R, B inputs.";
+            wIdx = 4;
+        }
+        // W, R, B may be computed by the model, but their shapes must be known.
+        for (size_t i = wIdx; i < std::min(wIdx + 3, op->get_input_size()); i++) {
+            if (op->get_input_partial_shape(i).is_dynamic()) {
+                errorMessage = "Node expects static shapes of W, R, B inputs.";
                 return false;
             }
         }
 
         auto rnnCellBase = ov::as_type_ptr<const ov::op::util::RNNCellBase>(op);
-        if (rnnCellBase && rnnCellBase->get_clip() != 0.f) {
-            errorMessage = "Clipping is not supported for RNN primitive.";
+        if (rnnCellBase && !isClipSupported(rnnCellBase)) {
+            errorMessage = "Clipping is supported for RNN primitive only in the saturation range of the activations.";
             return false;
         }
 
@@ -243,6 +232,20 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
     return true;
 }
 
+bool MKLDNNRNN::isClipSupported(const std::shared_ptr<const ngraph::op::util::RNNCellBase>& cell) noexcept {
+    // oneDNN RNN primitives don't clip the gates. Clipping is still equivalent when the threshold is in the saturation
+    // range of the activations: in FP32 tanh is 1.f beyond ~9, sigmoid is 1.f beyond ~17 and sigmoid(-20) is ~2e-9.
+    const float clip = cell->get_clip();
+    if (clip == 0.f)
+        return true;
+    if (clip < saturatedClip)
+        return false;
+    const auto& activations = cell->get_activations();
+    return std::all_of(activations.begin(), activations.end(), [](const std::string& act) {
+        return one_of(act, "sigmoid", "tanh");
+    });
+}
+
 MKLDNNRNN::MKLDNNRNN(const std::shared_ptr<ov::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(op, eng, cache) {
     std::string errorMessage;
@@ -533,8 +536,12 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     if (r_ptr == nullptr)
         IE_THROW(NotAllocated) << "Internal blob was not allocated for node " << getName() << ".";
 
-    const size_t ie_w_vec_size = getInputShapeAtPort(wIdx).getElementsCount();
-    const size_t ie_r_vec_size = getInputShapeAtPort(rIdx).getElementsCount();
+    internalBlobs.push_back(w_data_mem);
+    internalBlobs.push_back(w_state_mem);
+
+    // non-constant weights are repacked on execution, see updateWeights()
+    if (!constWeights)
+        return;
 
     auto *wInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(wIdx)[0]->getParent().get());
     auto wConstBlob = wInputNode->getMemoryPtr();
@@ -542,12 +549,22 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
     auto *rInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(rIdx)[0]->getParent().get());
     auto rConstBlob = rInputNode->getMemoryPtr();
 
+    repackWeights<Prec>(gate_map, wConstBlob->GetPtr(), rConstBlob->GetPtr(), weightPrec, w_ptr, r_ptr);
+}
+
+template <typename Prec>
+void MKLDNNRNN::repackWeights(const int *gate_map, const void* wSrc, const void* rSrc, const Precision& srcPrec,
+                              Prec* w_ptr, Prec* r_ptr) {
+    const auto& dataPrecision = getOriginalInputPrecisionAtPort(0);
+    const size_t ie_w_vec_size = getInputShapeAtPort(wIdx).getElementsCount();
+    const size_t ie_r_vec_size = getInputShapeAtPort(rIdx).getElementsCount();
+
     std::vector<Prec> ie_w_vec(ie_w_vec_size), ie_r_vec(ie_r_vec_size);
 
     auto ie_w_ptr = ie_w_vec.data();
     auto ie_r_ptr = ie_r_vec.data();
-    cpu_convert(wConstBlob->GetPtr(), ie_w_ptr, weightPrec, dataPrecision, ie_w_vec_size);
-    cpu_convert(rConstBlob->GetPtr(), ie_r_ptr, weightPrec, dataPrecision, ie_r_vec_size);
+    cpu_convert(wSrc, ie_w_ptr, srcPrec, dataPrecision, ie_w_vec_size);
+    cpu_convert(rSrc, ie_r_ptr, srcPrec, dataPrecision, ie_r_vec_size);
 
     const int step = SC * G;
 
@@ -568,9 +585,6 @@ void MKLDNNRNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t
             }
         }
     }
-
-    internalBlobs.push_back(w_data_mem);
-    internalBlobs.push_back(w_state_mem);
 }
 
 template <Precision::ePrecision Prec>
@@ -589,14 +603,29 @@ void MKLDNNRNN::fillBiases(const int *gate_map) {
     if (b_ptr == nullptr)
         IE_THROW(NotAllocated) << "Internal blob was not allocated for node " << getName() << ".";
 
+    internalBlobs.push_back(w_bias_data_mem);
+
+    // non-constant biases are repacked on execution, see updateWeights()
+    if (!constWeights)
+        return;
+
     auto *constInputNode = dynamic_cast<MKLDNNInputNode *>(getParentEdgesAtPort(bIdx)[0]->getParent().get());
     auto constBlob = constInputNode->getMemoryPtr();
-    auto const elementsCount = constBlob->GetSize() / constBlob->getDesc().getPrecision().size();
+
+    repackBiases<Prec>(gate_map, constBlob->GetPtr(), MKLDNNExtensionUtils::DataTypeToIEPrecision(constBlob->GetDataType()), b_ptr);
+}
+
+template <Precision::ePrecision Prec>
+void MKLDNNRNN::repackBiases(const int *gate_map, const void* bSrc, const Precision& srcPrec,
+                             typename PrecisionTrait<Prec>::value_type* b_ptr) {
+    using dataType = typename PrecisionTrait<Prec>::value_type;
+
+    const size_t elementsCount = getInputShapeAtPort(bIdx).getElementsCount();
 
     std::vector<dataType> ie_b_vec(elementsCount);
-    cpu_convert(constBlob->GetPtr(),
+    cpu_convert(bSrc,
                 &ie_b_vec[0],
-                MKLDNNExtensionUtils::DataTypeToIEPrecision(constBlob->GetDataType()),
+                srcPrec,
                 Prec,
                 elementsCount);
 
@@ -605,7 +634,6 @@ void MKLDNNRNN::fillBiases(const int *gate_map) {
         const dataType *l_ie_b_ptr = &ie_b_vec[g * SC];
         cpu_memcpy(l_b_ptr, l_ie_b_ptr, SC * sizeof(typename PrecisionTrait<Prec>::value_type));
     }
-    internalBlobs.push_back(w_bias_data_mem);
 }
 
 void MKLDNNRNN::copyWeightsData() {
@@ -628,9 +656,9 @@ void MKLDNNRNN::copyWeightsData() {
      *   ====== GRU ======
      *   IE - URO, mkldnn - URO
      */
-    const int gate_map_lstm[] = {1, 0, 2, 3};  // FICO -> IFCO
-    const int gate_map_gru[]  = {0, 1, 2, 3};
-    const int gate_map_rnn[]  = {0};
+    static const int gate_map_lstm[] = {1, 0, 2, 3};  // FICO -> IFCO
+    static const int gate_map_gru[]  = {0, 1, 2, 3};
+    static const int gate_map_rnn[]  = {0};
     const int *gate_map;
     const int gate_map_lstm_size = sizeof(gate_map_lstm) / sizeof(int);
     const int gate_map_gru_size = sizeof(gate_map_gru) / sizeof(int);
@@ -662,6 +690,16 @@ void MKLDNNRNN::copyWeightsData() {
         }
     }
 
+    gateMap = gate_map;
+
+    auto isConstInput = [this](size_t port) {
+        const auto& parent = getParentEdgesAtPort(port)[0]->getParent();
+        return parent->getType() == Input && parent->isConstant();
+    };
+    constWeights = isConstInput(wIdx) && isConstInput(rIdx) && isConstInput(bIdx);
+    if (!constWeights)
+        weightsSnapshots.resize(3);
+
     const auto& dataPrecision = getOriginalInputPrecisionAtPort(0);
     if (dataPrecision == Precision::BF16) {
         fillWeights<uint16_t>(gate_map, wIdx, rIdx);
@@ -678,70 +716,71 @@ void MKLDNNRNN::copyWeightsData() {
         fillBiases<Precision::FP32>(gate_map);
 }
 
-void MKLDNNRNN::fillDescs() {
-    descs.clear();
-
+MKLDNNDescriptor MKLDNNRNN::createRNNDescriptor(const std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                                                const std::vector<DnnlBlockedMemoryDescPtr>& outDescs,
+                                                const std::vector<mkldnn::memory::desc>& weightsDescs) const {
     switch (cell_type) {
         case mkldnn::algorithm::vanilla_rnn: {
-            MKLDNNDescriptor desc(std::make_shared<vanilla_rnn_forward::desc>(
+            return MKLDNNDescriptor(std::make_shared<vanilla_rnn_forward::desc>(
                                         prop_kind::forward_scoring,
                                         cell_act,
                                         direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                    /* In Data       */ inDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* In State      */ inDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
+                    /* Weights data  */ weightsDescs[0],
+                    /* Weights state */ weightsDescs[1],
+                    /* Bias          */ weightsDescs[2],
+                    /* Out Data      */ outDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* Out State     */ outDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
+        }
         case mkldnn::algorithm::vanilla_gru: {
-            MKLDNNDescriptor desc(std::make_shared<gru_forward::desc>(
+            return MKLDNNDescriptor(std::make_shared<gru_forward::desc>(
                                         prop_kind::forward_scoring,
                                         direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                    /* In Data       */ inDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* In State      */ inDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
+                    /* Weights data  */ weightsDescs[0],
+                    /* Weights state */ weightsDescs[1],
+                    /* Bias          */ weightsDescs[2],
+                    /* Out Data      */ outDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* Out State     */ outDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
+        }
         case mkldnn::algorithm::lbr_gru: {
-            MKLDNNDescriptor desc(std::make_shared<lbr_gru_forward::desc>(
+            return MKLDNNDescriptor(std::make_shared<lbr_gru_forward::desc>(
                                         prop_kind::forward_scoring,
                                         direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                    /* In Data       */ inDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* In State      */ inDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
+                    /* Weights data  */ weightsDescs[0],
+                    /* Weights state */ weightsDescs[1],
+                    /* Bias          */ weightsDescs[2],
+                    /* Out Data      */ outDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* Out State     */ outDescs[RNNInOutKind::HiddenState]->getDnnlDesc()));
+        }
         case mkldnn::algorithm::vanilla_lstm: {
-            MKLDNNDescriptor desc(std::make_shared<lstm_forward::desc>(
+            return MKLDNNDescriptor(std::make_shared<lstm_forward::desc>(
                                         prop_kind::forward_scoring,
                                         direction,
-                    /* In Data       */ inDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* In State      */ inDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* In State C    */ inDataDescs[RNNInOutKind::CellState]->getDnnlDesc(),
-                    /* Weights data  */ wDescs[0],
-                    /* Weights state */ wDescs[1],
-                    /* Bias          */ wDescs[2],
-                    /* Out Data      */ outDataDescs[RNNInOutKind::Layer]->getDnnlDesc(),
-                    /* Out State     */ outDataDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
-                    /* Out State C   */ outDataDescs[RNNInOutKind::CellState]->getDnnlDesc()));
-            descs.push_back(desc);
-        } break;
+                    /* In Data       */ inDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* In State      */ inDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
+                    /* In State C    */ inDescs[RNNInOutKind::CellState]->getDnnlDesc(),
+                    /* Weights data  */ weightsDescs[0],
+                    /* Weights state */ weightsDescs[1],
+                    /* Bias          */ weightsDescs[2],
+                    /* Out Data      */ outDescs[RNNInOutKind::Layer]->getDnnlDesc(),
+                    /* Out State     */ outDescs[RNNInOutKind::HiddenState]->getDnnlDesc(),
+                    /* Out State C   */ outDescs[RNNInOutKind::CellState]->getDnnlDesc()));
+        }
         default:
             THROW_ERROR << "has unknown cell type.";
     }
 }
 
+void MKLDNNRNN::fillDescs() {
+    descs.clear();
+    descs.push_back(createRNNDescriptor(inDataDescs, outDataDescs, wDescs));
+}
+
 void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                  const std::vector<MemoryDescPtr> &outputDesc) {
     if (descs.empty()) {
@@ -780,6 +819,58 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
     supportedPrimitiveDescriptors.emplace_back(config, ref_any);
 }
 
+void MKLDNNRNN::fillDataDescs(size_t SL, size_t B, std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                              std::vector<DnnlBlockedMemoryDescPtr>& outDescs) const {
+    const auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(0));
+    const Shape shapeS_4D{L, D, B, SC};
+
+    inDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, dataType, memory::format_tag::tnc);
+    outDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, SC}, dataType, memory::format_tag::tnc);
+
+    inDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, dataType, memory::format_tag::ldnc);
+    outDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, dataType, memory::format_tag::ldnc);
+
+    if (haveCellState(cell_type)) {
+        inDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, memory::data_type::f32, memory::format_tag::ldnc);
+        outDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, memory::data_type::f32, memory::format_tag::ldnc);
+    }
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNRNN::getPrimitive(const std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                                                        const std::vector<DnnlBlockedMemoryDescPtr>& outDescs,
+                                                        const std::vector<mkldnn::memory::desc>& weightsDescs) const {
+    RNNKey key = { inDescs, outDescs, weightsDescs, cell_type };
+
+    auto builder = [this](const RNNKey& key) -> std::shared_ptr<mkldnn::primitive> {
+        auto rnnDesc = createRNNDescriptor(key.inDataDescs, key.outDataDescs, key.wDescs);
+
+        if (key.cellType == mkldnn::algorithm::vanilla_rnn) {
+            std::shared_ptr<vanilla_rnn_forward::desc> desc = rnnDesc;
+            return std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(*desc, getEngine()));
+        } else if (key.cellType == mkldnn::algorithm::vanilla_gru) {
+            std::shared_ptr<gru_forward::desc> desc = rnnDesc;
+            return std::make_shared<gru_forward>(gru_forward::primitive_desc(*desc, getEngine()));
+        } else if (key.cellType == mkldnn::algorithm::lbr_gru) {
+            std::shared_ptr<lbr_gru_forward::desc> desc = rnnDesc;
+            return std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(*desc, getEngine()));
+        } else if (key.cellType == mkldnn::algorithm::vanilla_lstm) {
+            std::shared_ptr<lstm_forward::desc> desc = rnnDesc;
+            return std::make_shared<lstm_forward>(lstm_forward::primitive_desc(*desc, getEngine()));
+        } else {
+            return nullptr;
+        }
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+
+    if (!result.first) {
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+    }
+
+    return result.first;
+}
+
 void MKLDNNRNN::prepareParams() {
     for (size_t i = 0; i < wIdx; i++) {
         auto memPtr = getParentEdgesAtPort(i).front()->getMemoryPtr();
@@ -793,18 +884,8 @@ void MKLDNNRNN::prepareParams() {
     auto dataMemPtr = getParentEdgesAtPort(0).front()->getMemoryPtr();
     const size_t B = dataMemPtr->GetShape().getStaticDims()[0];
     const size_t SL = is_cell ? 1lu : dataMemPtr->GetShape().getStaticDims()[1];
-    const Shape shapeS_4D{L, D, B, SC};
-
-    inDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, DC}, dataType, memory::format_tag::tnc);
-    outDataDescs[0] = std::make_shared<DnnlBlockedMemoryDesc>(Shape{SL, B, SC}, dataType, memory::format_tag::tnc);
-
-    inDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, dataType, memory::format_tag::ldnc);
-    outDataDescs[1] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, dataType, memory::format_tag::ldnc);
 
-    if (haveCellState(cell_type)) {
-        inDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, memory::data_type::f32, memory::format_tag::ldnc);
-        outDataDescs[2] = std::make_shared<DnnlBlockedMemoryDesc>(shapeS_4D, memory::data_type::f32, memory::format_tag::ldnc);
-    }
+    fillDataDescs(SL, B, inDataDescs, outDataDescs);
 
     bool wFormatWasChanged = false;
     // WA To avoid different weights layer and iter formats in FP32 case.
@@ -826,41 +907,70 @@ void MKLDNNRNN::prepareParams() {
         wDescs[1] = mkldnn::memory::desc(statesDims, dataType, wFormat);
     }
 
-    RNNKey key = { inDataDescs, outDataDescs, wDescs, cell_type };
+    prim = getPrimitive(inDataDescs, outDataDescs, wDescs);
 
-    auto builder = [this](const RNNKey& key) -> std::shared_ptr<mkldnn::primitive> {
+    if (!wasMemoryPrepared || wFormatWasChanged) {
         fillDescs();
+        auto itpd = descs[0].createPrimitiveDescriptorIterator(getEngine(), mkldnn::primitive_attr());
+        if (constWeights)
+            prepareMemory(itpd);
+        else
+            prepareWeightsMemory(itpd);
+        wasMemoryPrepared = true;
+    }
+}
 
-        if (key.cellType == mkldnn::algorithm::vanilla_rnn) {
-            std::shared_ptr<vanilla_rnn_forward::desc> desc = descs[0];
-            return std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::vanilla_gru) {
-            std::shared_ptr<gru_forward::desc> desc = descs[0];
-            return std::make_shared<gru_forward>(gru_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::lbr_gru) {
-            std::shared_ptr<lbr_gru_forward::desc> desc = descs[0];
-            return std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(*desc, getEngine()));
-        } else if (key.cellType == mkldnn::algorithm::vanilla_lstm) {
-            std::shared_ptr<lstm_forward::desc> desc = descs[0];
-            return std::make_shared<lstm_forward>(lstm_forward::primitive_desc(*desc, getEngine()));
-        } else {
-            return nullptr;
-        }
-    };
-
-    auto cache = getRuntimeCache();
-    auto result = cache->getOrCreate(key, builder);
+void MKLDNNRNN::prepareWeightsMemory(mkldnn::primitive_desc_iterator& itpd) {
+    // the weights cache is bypassed: the content is not known until execution and changes between inferences
+    internalBlobMemory.clear();
+    for (size_t i = 0; i < internalBlobs.size(); i++) {
+        MKLDNNMemoryPtr ptr = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        ptr->Create(*internalBlobDesc[i](itpd, 0));
+        internalBlobMemory.push_back(ptr);
+    }
+    // the new memory must be filled regardless of the inputs content
+    for (auto& snapshot : weightsSnapshots) {
+        snapshot.ptr = nullptr;
+        snapshot.data.clear();
+    }
+}
 
-    if (!result.first) {
-        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+void MKLDNNRNN::updateWeights() {
+    const size_t ports[] = {wIdx, rIdx, bIdx};
+    const void* src[3];
+    Precision srcPrec[3];
+    bool changed = false;
+    for (size_t i = 0; i < 3; i++) {
+        const auto& mem = getParentEdgesAtPort(ports[i])[0]->getMemory();
+        const auto* data = static_cast<const uint8_t*>(mem.GetPtr());
+        const size_t size = mem.GetSize();
+        src[i] = data;
+        srcPrec[i] = mem.getDesc().getPrecision();
+
+        auto& snapshot = weightsSnapshots[i];
+        if (snapshot.ptr != data || snapshot.data.size() != size || std::memcmp(snapshot.data.data(), data, size) != 0) {
+            snapshot.ptr = data;
+            snapshot.data.assign(data, data + size);
+            changed = true;
+        }
     }
+    if (!changed)
+        return;
 
-    prim = result.first;
+    if (getOriginalInputPrecisionAtPort(0) == Precision::BF16) {
+        repackWeights<uint16_t>(gateMap, src[0], src[1], srcPrec[0],
+                                static_cast<uint16_t*>(internalBlobs[0]->buffer()), static_cast<uint16_t*>(internalBlobs[1]->buffer()));
+    } else {
+        repackWeights<float>(gateMap, src[0], src[1], srcPrec[0],
+                             static_cast<float*>(internalBlobs[0]->buffer()), static_cast<float*>(internalBlobs[1]->buffer()));
+    }
+    repackBiases<Precision::FP32>(gateMap, src[2], srcPrec[2], static_cast<float*>(internalBlobs[2]->buffer()));
 
-    if (!wasMemoryPrepared || wFormatWasChanged) {
-        auto itpd = descs[0].createPrimitiveDescriptorIterator(getEngine(), mkldnn::primitive_attr());
-        prepareMemory(itpd);
-        wasMemoryPrepared = true;
+    for (size_t i = 0; i < internalBlobs.size(); i++) {
+        auto desc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlobs[i]->getTensorDesc());
+        MKLDNNMemory memory{ getEngine() };
+        memory.Create(desc, internalBlobs[i]->buffer());
+        internalBlobMemory[i]->SetData(memory);
     }
 }
 
@@ -878,6 +988,21 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     if (!prim)
         THROW_ERROR << "does not have initialized primitive to execute.";
 
+    if (!constWeights)
+        updateWeights();
+
+    if (!is_cell) {
+        // sequence lengths are placed after the initial states
+        const auto& seqLengthsMem = getParentEdgesAtPort(S + 1)[0]->getMemory();
+        const auto* seqLengths = reinterpret_cast<const int32_t*>(seqLengthsMem.GetPtr());
+        const auto& dims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+        const int32_t SL = static_cast<int32_t>(dims[1]);
+        if (std::any_of(seqLengths, seqLengths + dims[0], [SL](int32_t len) { return len != SL; })) {
+            executeWithSeqLengths(strm, seqLengths);
+            return;
+        }
+    }
+
     const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
@@ -915,6 +1040,104 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
     (*prim).execute(strm, args);
 }
 
+void MKLDNNRNN::executeWithSeqLengths(mkldnn::stream strm, const int32_t* seqLengths) {
+    const auto& srcMem = getParentEdgeAt(0)->getMemory();
+    const auto& dims = srcMem.getStaticDims();
+    const size_t B = dims[0];
+    const size_t SL = dims[1];
+    const size_t dataSize = srcMem.getDesc().getPrecision().size();
+    const size_t xRow = DC * dataSize, yRow = SC * dataSize, hRow = SC * dataSize, cRow = SC * sizeof(float);
+    const size_t nStateOutputs = std::min(S, outputShapes.size() - 1);
+
+    // The layer data is [SL, B, C] and the states are [B, SC] in memory for all the supported layouts.
+    const auto* src = static_cast<const uint8_t*>(srcMem.GetPtr());
+    auto* dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemory().GetPtr());
+    const uint8_t* srcStates[2] = {};
+    uint8_t* dstStates[2] = {};
+    for (size_t s = 0; s < S; s++)
+        srcStates[s] = static_cast<const uint8_t*>(getParentEdgeAt(s + 1)->getMemory().GetPtr());
+    for (size_t s = 0; s < nStateOutputs; s++)
+        dstStates[s] = static_cast<uint8_t*>(getChildEdgesAtPort(s + 1)[0]->getMemory().GetPtr());
+    const size_t stateRows[2] = {hRow, cRow};
+
+    // Samples of the same length are computed by one primitive of that length, so no steps are spent on the padding.
+    std::map<size_t, std::vector<size_t>> groups;
+    for (size_t n = 0; n < B; n++)
+        groups[static_cast<size_t>(std::min(std::max(seqLengths[n], 0), static_cast<int32_t>(SL)))].push_back(n);
+
+    // the node descs are kept for the full sequence, the group primitives differ from it by the data descs only
+    auto groupInDescs = inDataDescs;
+    auto groupOutDescs = outDataDescs;
+    // the group primitives use the weights prepared for the full sequence
+    auto groupWDescs = wDescs;
+    groupWDescs[0] = internalBlobMemory[0]->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    groupWDescs[1] = internalBlobMemory[1]->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+
+    for (const auto& group : groups) {
+        const size_t len = group.first;
+        const auto& samples = group.second;
+        const size_t Bg = samples.size();
+
+        if (len == 0) {
+            parallel_for2d(SL, Bg, [&](size_t t, size_t b) {
+                std::memset(dst + (t * B + samples[b]) * yRow, 0, yRow);
+            });
+            for (size_t s = 0; s < nStateOutputs; s++) {
+                for (size_t b = 0; b < Bg; b++)
+                    std::memset(dstStates[s] + samples[b] * stateRows[s], 0, stateRows[s]);
+            }
+            continue;
+        }
+
+        fillDataDescs(len, Bg, groupInDescs, groupOutDescs);
+        auto groupPrim = getPrimitive(groupInDescs, groupOutDescs, groupWDescs);
+
+        const size_t xSize = len * Bg * xRow, ySize = len * Bg * yRow;
+        const size_t stateSizes[2] = {Bg * hRow, Bg * cRow};
+        groupBuffer.resize(std::max(groupBuffer.size(), xSize + ySize + 2 * (stateSizes[0] + stateSizes[1])));
+        uint8_t* x = groupBuffer.data();
+        uint8_t* y = x + xSize;
+        uint8_t* statesIn[2] = {y + ySize, y + ySize + stateSizes[0]};
+        uint8_t* statesOut[2] = {statesIn[1] + stateSizes[1], statesIn[1] + stateSizes[1] + stateSizes[0]};
+
+        parallel_for2d(len, Bg, [&](size_t t, size_t b) {
+            cpu_memcpy(x + (t * Bg + b) * xRow, src + (t * B + samples[b]) * xRow, xRow);
+        });
+        for (size_t s = 0; s < S; s++) {
+            for (size_t b = 0; b < Bg; b++)
+                cpu_memcpy(statesIn[s] + b * stateRows[s], srcStates[s] + samples[b] * stateRows[s], stateRows[s]);
+        }
+
+        std::unordered_map<int, memory> args {
+            {DNNL_ARG_SRC_LAYER,     memory(groupInDescs[RNNInOutKind::Layer]->getDnnlDesc(), getEngine(), x)},
+            {DNNL_ARG_WEIGHTS_LAYER, internalBlobMemory[0]->GetPrimitive()},
+            {DNNL_ARG_WEIGHTS_ITER,  internalBlobMemory[1]->GetPrimitive()},
+            {DNNL_ARG_BIAS,          internalBlobMemory[2]->GetPrimitive()},
+            {DNNL_ARG_DST_LAYER,     memory(groupOutDescs[RNNInOutKind::Layer]->getDnnlDesc(), getEngine(), y)},
+        };
+        int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
+        int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+        for (size_t s = 0; s < S; s++) {
+            args[state_i_tags[s]] = memory(groupInDescs[s + 1]->getDnnlDesc(), getEngine(), statesIn[s]);
+            args[state_o_tags[s]] = memory(groupOutDescs[s + 1]->getDnnlDesc(), getEngine(), statesOut[s]);
+        }
+
+        groupPrim->execute(strm, args);
+
+        parallel_for2d(SL, Bg, [&](size_t t, size_t b) {
+            uint8_t* out = dst + (t * B + samples[b]) * yRow;
+            if (t < len)
+                cpu_memcpy(out, y + (t * Bg + b) * yRow, yRow);
+            else
+                std::memset(out, 0, yRow);
+        });
+        for (size_t s = 0; s < nStateOutputs; s++) {
+            for (size_t b = 0; b < Bg; b++)
+                cpu_memcpy(dstStates[s] + samples[b] * stateRows[s], statesOut[s] + b * stateRows[s], stateRows[s]);
+        }
+    }
+}
+
 void MKLDNNRNN::executeDynamicImpl(mkldnn::stream strm) {
     execute(strm);
 }
@@ -934,7 +1157,7 @@ std::vector<VectorDims> MKLDNNRNN::shapeInfer() const {
 }
 
 void MKLDNNRNN::cleanup() {
-    if (!isDynamicNode()) {
+    if (!isDynamicNode() && constWeights) {
         internalBlobs.clear();
     }
 
@@ -6,6 +6,7 @@
 
 #include <mkldnn_node.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <ngraph/op/util/rnn_cell_base.hpp>
 
 #include <string>
 #include <memory>
@@ -18,6 +19,7 @@ public:
     MKLDNNRNN(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+    static bool isClipSupported(const std::shared_ptr<const ngraph::op::util::RNNCellBase>& cell) noexcept;
     void getSupportedDescriptors() override;
     std::shared_ptr<MemoryDesc> getSrcMemDesc(mkldnn::primitive_desc_iterator& primitive_desc_it, size_t idx) override;
     std::shared_ptr<MemoryDesc> getDstMemDesc(mkldnn::primitive_desc_iterator& primitive_desc_it, size_t idx) override;
@@ -43,6 +45,9 @@ private:
     void initSequence();
     void fillCellDesc();
     void fillSequenceDesc();
+    MKLDNNDescriptor createRNNDescriptor(const std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                                         const std::vector<DnnlBlockedMemoryDescPtr>& outDescs,
+                                         const std::vector<mkldnn::memory::desc>& weightsDescs) const;
     void fillDescs();
     bool verifyWeightsPrecision(const InferenceEngine::Precision& layerPrec,
                                 const InferenceEngine::Precision& weightsPrec);
@@ -51,8 +56,23 @@ private:
     void fillWeights(const int* gate_map, const size_t wIdx, const size_t rIdx);
     template <InferenceEngine::Precision::ePrecision Prec>
     void fillBiases(const int* gate_map);
+    template <typename Prec>
+    void repackWeights(const int* gate_map, const void* wSrc, const void* rSrc, const InferenceEngine::Precision& srcPrec,
+                       Prec* w_ptr, Prec* r_ptr);
+    template <InferenceEngine::Precision::ePrecision Prec>
+    void repackBiases(const int* gate_map, const void* bSrc, const InferenceEngine::Precision& srcPrec,
+                      typename InferenceEngine::PrecisionTrait<Prec>::value_type* b_ptr);
 
     void copyWeightsData();
+    void prepareWeightsMemory(mkldnn::primitive_desc_iterator& itpd);
+    void updateWeights();
+
+    void fillDataDescs(size_t SL, size_t B, std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                       std::vector<DnnlBlockedMemoryDescPtr>& outDescs) const;
+    std::shared_ptr<mkldnn::primitive> getPrimitive(const std::vector<DnnlBlockedMemoryDescPtr>& inDescs,
+                                                    const std::vector<DnnlBlockedMemoryDescPtr>& outDescs,
+                                                    const std::vector<mkldnn::memory::desc>& weightsDescs) const;
+    void executeWithSeqLengths(mkldnn::stream strm, const int32_t* seqLengths);
 
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
@@ -72,6 +92,22 @@ private:
     /** Weights data and state memory format: ldigo or any */
     mkldnn::memory::format_tag wFormat = mkldnn::memory::format_tag::any;
 
+    /** W, R and B are constant inputs and repacked once, otherwise they are repacked when the inputs change */
+    bool constWeights = true;
+
+    /** Gate order of the weights in the oneDNN layout */
+    const int* gateMap = nullptr;
+
+    struct WeightsSnapshot {
+        const void* ptr = nullptr;
+        std::vector<uint8_t> data;
+    };
+    /** The last repacked content of non-constant W, R and B inputs */
+    std::vector<WeightsSnapshot> weightsSnapshots;
+
+    /** Scratch buffers for the samples of the same sequence length */
+    std::vector<uint8_t> groupBuffer;
+
     struct Interval {
         Interval() = default;
 
@@ -116,6 +152,7 @@ private:
 
     static constexpr size_t optimalBatchSize = 16lu;
     static constexpr size_t batchDimDummyValue = 64lu;
+    static constexpr float saturatedClip = 20.f;
 
     bool wasMemoryPrepared = false;
 };
@@ -12,6 +12,7 @@
 #include <utils/bfloat16.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include "ie_parallel.hpp"
+#include "utils/general_utils.h"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
 
@@ -177,7 +178,6 @@ void MKLDNNROIAlignNode::executeSpecified() {
     auto srcBlockDesc = srcMemory0.GetDescWithType<BlockedMemoryDesc>();
     auto dstBlockDesc = dstMemory.GetDescWithType<BlockedMemoryDesc>();
 
-    auto isPlainFmt = srcBlockDesc->hasLayoutType(LayoutType::ncsp);
     auto isNhwcFmt =  srcBlockDesc->hasLayoutType(LayoutType::nspc);
     auto isBlkFmt =   srcBlockDesc->hasLayoutType(LayoutType::nCsp16c) || srcBlockDesc->hasLayoutType(LayoutType::nCsp8c);
 
@@ -204,26 +204,31 @@ void MKLDNNROIAlignNode::executeSpecified() {
     const int wInputStride = srcStrides[3 + tailDimsOffset];
     const int hOutputStride = dstStrides[2 + tailDimsOffset];
     const int wOutputStride = dstStrides[3 + tailDimsOffset];
-    const int chPadding = blockSize * srcBlockDesc->getBlockDims()[1];
-    const int blockCount = chPadding / blockSize;
+    const int chPadding = isNhwcFmt ? C : blockSize * srcBlockDesc->getBlockDims()[1];
 
     for (; realRois < nominalRoiCount; realRois++) {
         auto roiBatchInd = srcRoiIdx[realRois];
         if (roiBatchInd == -1) {
             break;
         }
-    }
-
-    for (int n = 0; n < realRois; ++n) {
-        int roiOff = n * 4;
-        const float* srcRoiPtr = &srcRoi[roiOff];
-        int roiBatchInd = srcRoiIdx[n];
         if (roiBatchInd < -1) {  // -1 means switched off region
             IE_THROW() << "Batch index cannot be less, than -1";
         } else if (roiBatchInd >= inputDimVector[0]) {
             IE_THROW() << "Demanded batch (id = " << roiBatchInd << ") doesn't exist";
         }
+    }
+
+    struct RoiGeometry {
+        float x1;
+        float y1;
+        float binHeight;
+        float binWidth;
+        int samplingRatioX;
+        int samplingRatioY;
+    };
 
+    auto getRoiGeometry = [&](int n) {
+        const float* srcRoiPtr = &srcRoi[n * 4];
         float x1 = srcRoiPtr[0] * spatialScale;
         float y1 = srcRoiPtr[1] * spatialScale;
         float x2 = srcRoiPtr[2] * spatialScale;
@@ -236,29 +241,42 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
         auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
         auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
+        return RoiGeometry{x1, y1, binHeight, binWidth, samplingRatioX, samplingRatioY};
+    };
 
-        uint64_t numSamplesInBin = static_cast<uint64_t>(samplingRatioX) * samplingRatioY;
+    // Sampling points and bilinear weights depend only on the ROI, so they are computed once per ROI
+    // and used for all channels. Every sample point has 4 input offsets and 4 weights.
+    roiSamplesInBin.resize(realRois);
+    roiTableStart.resize(realRois + 1);
+    roiTableStart[0] = 0;
+    for (int n = 0; n < realRois; n++) {
+        const auto geometry = getRoiGeometry(n);
+        roiSamplesInBin[n] = geometry.samplingRatioX * geometry.samplingRatioY;
+        roiTableStart[n + 1] = roiTableStart[n] + 4 * static_cast<size_t>(binCount) * roiSamplesInBin[n];
+    }
 
-        float sampleDistanceX = binWidth / samplingRatioX;
-        float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
-        std::vector<std::pair<int, int>> pointVector;
-        std::vector<float> weightVector;
-        pointVector.reserve(4 * numSamplesInBin * binCount);
-        weightVector.reserve(4 * numSamplesInBin * binCount);
+    // the tables hold the ROIs from tableStartRoi
+    auto fillSamplingTables = [&](int n, int tableStartRoi) {
+        const auto geometry = getRoiGeometry(n);
+        float sampleDistanceX = geometry.binWidth / geometry.samplingRatioX;
+        float sampleDistanceY = geometry.binHeight / geometry.samplingRatioY;
 
+        int* offsets = &samplingOffsets[roiTableStart[n] - roiTableStart[tableStartRoi]];
+        float* weights = &samplingWeights[roiTableStart[n] - roiTableStart[tableStartRoi]];
         for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
             for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
                 // run into bin
-                for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
-                    float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
-                    for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++) {
-                        float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
+                for (int ySampleInd = 0; ySampleInd < geometry.samplingRatioY; ySampleInd++) {
+                    float sampleY = geometry.y1 + yBinInd * geometry.binHeight + sampleDistanceY * (0.5f + ySampleInd);
+                    for (int xSampleInd = 0; xSampleInd < geometry.samplingRatioX; xSampleInd++) {
+                        float sampleX = geometry.x1 + xBinInd * geometry.binWidth + sampleDistanceX * (0.5f + xSampleInd);
                         if (sampleX < -1.0 || sampleX > W ||
                             sampleY < -1.0 || sampleY > H) {
                             // For this sample we save 4x point (0,0) with weight 0
-                            pointVector.insert(pointVector.end(), 4, {0, 0});
-                            weightVector.insert(weightVector.end(), 4, float{0});
+                            std::fill(offsets, offsets + 4, 0);
+                            std::fill(weights, weights + 4, 0.0f);
+                            offsets += 4;
+                            weights += 4;
                             continue;
                         }
                         sampleX = std::max(sampleX, float{0});
@@ -280,10 +298,10 @@ void MKLDNNROIAlignNode::executeSpecified() {
                         } else {
                             sampleXHigh = sampleXLow + 1;
                         }
-                        pointVector.push_back({sampleYLow, sampleXLow});
-                        pointVector.push_back({sampleYLow, sampleXHigh});
-                        pointVector.push_back({sampleYHigh, sampleXLow});
-                        pointVector.push_back({sampleYHigh, sampleXHigh});
+                        offsets[0] = sampleYLow * hInputStride + sampleXLow * wInputStride;
+                        offsets[1] = sampleYLow * hInputStride + sampleXHigh * wInputStride;
+                        offsets[2] = sampleYHigh * hInputStride + sampleXLow * wInputStride;
+                        offsets[3] = sampleYHigh * hInputStride + sampleXHigh * wInputStride;
 
                         // weight calculation for bilinear interpolation
                         auto ly = sampleY - sampleYLow;
@@ -291,75 +309,93 @@ void MKLDNNROIAlignNode::executeSpecified() {
                         auto hy = 1.0f - ly;
                         auto hx = 1.0f - lx;
 
-                        weightVector.push_back(hy * hx);
-                        weightVector.push_back(hy * lx);
-                        weightVector.push_back(ly * hx);
-                        weightVector.push_back(ly * lx);
+                        weights[0] = hy * hx;
+                        weights[1] = hy * lx;
+                        weights[2] = ly * hx;
+                        weights[3] = ly * lx;
+                        offsets += 4;
+                        weights += 4;
                     }
                 }
             }
         }
-        auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
-            float pooledValue = 0;
-            unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
-            for (unsigned int binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++) {
-                size_t part1Index = binOffsetInput_ + pointVector[sampleIndex].first * hInputStride +
-                                    pointVector[sampleIndex].second * wInputStride + blockResidual_;
-                float part1 = srcData[part1Index];
-                size_t part2Index = binOffsetInput_ + pointVector[sampleIndex + 1].first * hInputStride +
-                                    pointVector[sampleIndex + 1].second * wInputStride + blockResidual_;
-                float part2 = srcData[part2Index];
-                size_t part3Index = binOffsetInput_ + pointVector[sampleIndex + 2].first * hInputStride +
-                                    pointVector[sampleIndex + 2].second * wInputStride + blockResidual_;
-                float part3 = srcData[part3Index];
-                size_t part4Index = binOffsetInput_ + pointVector[sampleIndex + 3].first * hInputStride +
-                                    pointVector[sampleIndex + 3].second * wInputStride + blockResidual_;
-                float part4 = srcData[part4Index];
-
-                float sampleValue =
-                        weightVector[sampleIndex] * part1 +
-                        weightVector[sampleIndex + 1] * part2 +
-                        weightVector[sampleIndex + 2] * part3 +
-                        weightVector[sampleIndex + 3] * part4;
-                switch (getAlgorithm()) {
-                    case Algorithm::ROIAlignMax:
-                    {
-                        pooledValue = sampleValue > pooledValue ? sampleValue : pooledValue;
-                        break;
-                    }
-                    case Algorithm::ROIAlignAvg:
-                    default:
-                    {
-                        pooledValue += sampleValue / numSamplesInBin;
+    };
+
+    // Channels of a block are adjacent in memory for the blocked and nhwc layouts, so the innermost loop
+    // over them is vectorized. The plain layout has one channel per block.
+    const int channelBlock = isBlkFmt ? blockSize : (isNhwcFmt ? maxChannelBlock : 1);
+    const int channelBlocks = div_up(C, channelBlock);
+    const bool isMax = getAlgorithm() == Algorithm::ROIAlignMax;
+
+    auto poolChannelBlock = [&](int n, int blkIdx, int tableStartRoi) {
+        const int roiBatchInd = srcRoiIdx[n];
+        const int cStart = blkIdx * channelBlock;
+        const int cCount = std::min(channelBlock, C - cStart);
+        const size_t binOffsetInput = isNhwcFmt ? static_cast<size_t>(roiBatchInd) * C * H * W + cStart
+                                                : (static_cast<size_t>(roiBatchInd) * chPadding + cStart) * H * W;
+        const size_t binOffsetOutput = isNhwcFmt ? static_cast<size_t>(n) * C * binCount + cStart
+                                                 : (static_cast<size_t>(n) * chPadding + cStart) * binCount;
+        const int numSamplesInBin = roiSamplesInBin[n];
+        const int* offsets = &samplingOffsets[roiTableStart[n] - roiTableStart[tableStartRoi]];
+        const float* weights = &samplingWeights[roiTableStart[n] - roiTableStart[tableStartRoi]];
+
+        float pooledValues[maxChannelBlock];
+        for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
+            for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
+                std::fill(pooledValues, pooledValues + cCount, 0.0f);
+                for (int binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++) {
+                    const inputType* part1 = srcData + binOffsetInput + offsets[0];
+                    const inputType* part2 = srcData + binOffsetInput + offsets[1];
+                    const inputType* part3 = srcData + binOffsetInput + offsets[2];
+                    const inputType* part4 = srcData + binOffsetInput + offsets[3];
+                    const float weight1 = weights[0];
+                    const float weight2 = weights[1];
+                    const float weight3 = weights[2];
+                    const float weight4 = weights[3];
+                    if (isMax) {
+                        for (int c = 0; c < cCount; c++) {
+                            float sampleValue = weight1 * part1[c] + weight2 * part2[c] + weight3 * part3[c] + weight4 * part4[c];
+                            pooledValues[c] = sampleValue > pooledValues[c] ? sampleValue : pooledValues[c];
+                        }
+                    } else {
+                        for (int c = 0; c < cCount; c++) {
+                            float sampleValue = weight1 * part1[c] + weight2 * part2[c] + weight3 * part3[c] + weight4 * part4[c];
+                            pooledValues[c] += sampleValue / numSamplesInBin;
+                        }
                     }
+                    offsets += 4;
+                    weights += 4;
                 }
-                sampleIndex += 4;
+                outputType* dstPtr = dst + binOffsetOutput + yBinInd * hOutputStride + xBinInd * wOutputStride;
+                for (int c = 0; c < cCount; c++)
+                    dstPtr[c] = pooledValues[c];
             }
-            size_t dstIndex = binOffsetOutput_ + yBinInd_ * hOutputStride +
-                              xBinInd_ * wOutputStride + blockResidual_;
-            dst[dstIndex] = pooledValue;
-        };
-        if (isNhwcFmt) {
-            parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
-                for (int c = 0; c < C; c++) {
-                    size_t binOffsetInput = roiBatchInd * C * H * W + c;
-                    size_t binOffsetOutput = n * C * binCount + c;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, 0);
-                }
-            });
-        } else {  // nchw, nChw16c, nChw8c
-            parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
-                int cStart = blkIdx * blockSize;
-                int cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
-                for (int c = cStart; c < cEnd; c++) {
-                    const int blockResidual = (isPlainFmt ? 0 : c % blockSize);
-                    const int blockIdx = (c / blockSize) * blockSize;
-                    size_t binOffsetInput = (roiBatchInd * chPadding + blockIdx) * H * W;
-                    size_t binOffsetOutput = (n * chPadding + blockIdx) * binCount;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, blockResidual);
-                }
-            });
         }
+    };
+
+    // The tables of all ROIs may take hundreds of megabytes for thousands of ROIs with adaptive sampling,
+    // so the ROIs are processed by chunks with tables of bounded size.
+    for (int chunkStart = 0; chunkStart < realRois;) {
+        int chunkEnd = chunkStart + 1;
+        while (chunkEnd < realRois && roiTableStart[chunkEnd + 1] - roiTableStart[chunkStart] <= maxSamplingTableSize)
+            chunkEnd++;
+        const size_t tableSize = roiTableStart[chunkEnd] - roiTableStart[chunkStart];
+        samplingOffsets.resize(tableSize);
+        samplingWeights.resize(tableSize);
+
+        parallel_for(chunkEnd - chunkStart, [&](int i) {
+            fillSamplingTables(chunkStart + i, chunkStart);
+        });
+        parallel_for2d(chunkEnd - chunkStart, channelBlocks, [&](int i, int blkIdx) {
+            poolChannelBlock(chunkStart + i, blkIdx, chunkStart);
+        });
+        chunkStart = chunkEnd;
+    }
+
+    // a single ROI may need a table above the limit, it is not kept for the next inferences
+    if (samplingOffsets.capacity() > maxSamplingTableSize) {
+        std::vector<int>().swap(samplingOffsets);
+        std::vector<float>().swap(samplingWeights);
     }
 }
 
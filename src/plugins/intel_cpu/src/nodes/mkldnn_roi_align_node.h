@@ -32,6 +32,20 @@ private:
     int pooledW = 7;
     int samplingRatio = 2;
     float spatialScale = 1.0f;
+
+    // channels processed together by the innermost loop, the largest block of the blocked layouts
+    static constexpr int maxChannelBlock = 16;
+
+    // maximum number of entries of each sampling table, the ROIs are processed by chunks that fit into it
+    static constexpr size_t maxSamplingTableSize = 4 * 1024 * 1024;
+
+    // bilinear sampling tables of a chunk of ROIs: 4 input offsets and 4 weights per sample point,
+    // the table of the ROI n starts at roiTableStart[n] - roiTableStart[first ROI of the chunk]
+    std::vector<int> samplingOffsets;
+    std::vector<float> samplingWeights;
+    std::vector<size_t> roiTableStart;
+    std::vector<int> roiSamplesInBin;
+
     template <typename inputType, typename outputType>
     void executeSpecified();
     template<typename T>
@@ -0,0 +1,244 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "mkldnn_scaled_dot_product_attention_node.h"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+#include <mkldnn_selective_build.h>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNScaledDotProductAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op,
+                                                               std::string& errorMessage) noexcept {
+    try {
+        if (!ngraph::as_type_ptr<const ScaledDotProductAttentionNode>(op)) {
+            errorMessage = "Only CPU plugin ScaledDotProductAttention operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op,
+        const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+    errorPrefix = "ScaledDotProductAttention layer with name '" + op->get_friendly_name() + "' ";
+
+    if (!one_of(getOriginalInputsNumber(), 3, 4) || getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has incorrect number of input/output edges!";
+
+    const auto rank = getInputShapeAtPort(QUERIES_PORT).getRank();
+    if (rank < 2 || getInputShapeAtPort(KEYS_PORT).getRank() != rank || getInputShapeAtPort(VALUES_PORT).getRank() != rank)
+        IE_THROW() << errorPrefix << "has incorrect input ranks.";
+
+    const auto attention = ngraph::as_type_ptr<const ScaledDotProductAttentionNode>(op);
+    scale = attention->get_scale();
+    keysTransposed = attention->get_keys_transposed();
+    withMask = getOriginalInputsNumber() == 4;
+    if (withMask && getInputShapeAtPort(MASK_PORT).getRank() > rank)
+        IE_THROW() << errorPrefix << "has incorrect mask rank.";
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // computations are performed in FP32, BF16 data is converted on load and store
+    dataPrecision = getOriginalInputPrecisionAtPort(QUERIES_PORT);
+    if (dataPrecision != Precision::BF16)
+        dataPrecision = Precision::FP32;
+
+    addSupportedPrimDesc(std::vector<PortConfigurator>(getOriginalInputsNumber(), {LayoutType::ncsp, dataPrecision}),
+                         {{LayoutType::ncsp, dataPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNScaledDotProductAttentionNode::prepareParams() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto& memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!memPtr || !memPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << "has not allocated input memory.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << "has unidentified preferable primitive descriptor.";
+
+    const auto& queriesDims = getParentEdgeAt(QUERIES_PORT)->getMemory().getStaticDims();
+    const auto& keysDims = getParentEdgeAt(KEYS_PORT)->getMemory().getStaticDims();
+    const auto& valuesDims = getParentEdgeAt(VALUES_PORT)->getMemory().getStaticDims();
+    const size_t rank = queriesDims.size();
+
+    batch = std::accumulate(queriesDims.begin(), queriesDims.end() - 2, size_t(1), std::multiplies<size_t>());
+    queriesLen = queriesDims[rank - 2];
+    headSize = queriesDims[rank - 1];
+    keysLen = keysTransposed ? keysDims[rank - 1] : keysDims[rank - 2];
+    valuesHeadSize = valuesDims[rank - 1];
+
+    if (!std::equal(queriesDims.begin(), queriesDims.end() - 2, keysDims.begin()) ||
+        !std::equal(queriesDims.begin(), queriesDims.end() - 2, valuesDims.begin()))
+        IE_THROW() << errorPrefix << "has different batch dimensions of queries, keys and values.";
+    if ((keysTransposed ? keysDims[rank - 2] : keysDims[rank - 1]) != headSize || valuesDims[rank - 2] != keysLen)
+        IE_THROW() << errorPrefix << "has inconsistent dimensions of queries, keys and values.";
+
+    if (withMask) {
+        auto maskDims = getParentEdgeAt(MASK_PORT)->getMemory().getStaticDims();
+        maskDims.insert(maskDims.begin(), rank - maskDims.size(), 1);
+
+        VectorDims scoresDims(queriesDims.begin(), queriesDims.end() - 1);
+        scoresDims.push_back(keysLen);
+        VectorDims maskStrides(rank, 0);
+        size_t stride = 1;
+        for (int i = static_cast<int>(rank) - 1; i >= 0; i--) {
+            if (maskDims[i] != 1 && maskDims[i] != scoresDims[i])
+                IE_THROW() << errorPrefix << "has mask which is not broadcastable to the scores shape.";
+            maskStrides[i] = maskDims[i] == 1 ? 0 : stride;
+            stride *= maskDims[i];
+        }
+        maskRowStride = maskStrides[rank - 2];
+        maskColStride = maskStrides[rank - 1];
+
+        maskBatchOffsets.resize(batch);
+        for (size_t b = 0; b < batch; b++) {
+            size_t offset = 0;
+            size_t rest = b;
+            for (int i = static_cast<int>(rank) - 3; i >= 0; i--) {
+                offset += (rest % scoresDims[i]) * maskStrides[i];
+                rest /= scoresDims[i];
+            }
+            maskBatchOffsets[b] = offset;
+        }
+    }
+
+    const size_t blockSize = queriesBlockSize;
+    threadScratchSize = blockSize * valuesHeadSize + 2 * blockSize + keysBlockSize + blockSize * headSize;
+    scratch.resize(threadScratchSize * parallel_get_max_threads());
+}
+
+template <typename T>
+void MKLDNNScaledDotProductAttentionNode::attention() {
+    const T* queries = reinterpret_cast<const T*>(getParentEdgeAt(QUERIES_PORT)->getMemoryPtr()->GetPtr());
+    const T* keys = reinterpret_cast<const T*>(getParentEdgeAt(KEYS_PORT)->getMemoryPtr()->GetPtr());
+    const T* values = reinterpret_cast<const T*>(getParentEdgeAt(VALUES_PORT)->getMemoryPtr()->GetPtr());
+    const T* mask = withMask ? reinterpret_cast<const T*>(getParentEdgeAt(MASK_PORT)->getMemoryPtr()->GetPtr()) : nullptr;
+    T* dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t qBlockSize = queriesBlockSize;
+    const size_t kBlockSize = keysBlockSize;
+    const size_t queriesBlocks = div_up(queriesLen, qBlockSize);
+    const size_t workAmount = batch * queriesBlocks;
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+
+        float* acc = scratch.data() + ithr * threadScratchSize;
+        float* rowMax = acc + qBlockSize * valuesHeadSize;
+        float* rowSum = rowMax + qBlockSize;
+        float* scores = rowSum + qBlockSize;
+        float* scaledQueries = scores + kBlockSize;
+
+        for (size_t work = start; work < end; work++) {
+            const size_t b = work / queriesBlocks;
+            const size_t q0 = (work % queriesBlocks) * qBlockSize;
+            const size_t qn = std::min(qBlockSize, queriesLen - q0);
+
+            const T* q = queries + (b * queriesLen + q0) * headSize;
+            const T* k = keys + b * keysLen * headSize;
+            const T* v = values + b * keysLen * valuesHeadSize;
+            const T* m = withMask ? mask + maskBatchOffsets[b] + q0 * maskRowStride : nullptr;
+
+            for (size_t i = 0; i < qn * headSize; i++)
+                scaledQueries[i] = static_cast<float>(q[i]) * scale;
+            std::fill(acc, acc + qn * valuesHeadSize, 0.f);
+            std::fill(rowMax, rowMax + qn, -std::numeric_limits<float>::infinity());
+            std::fill(rowSum, rowSum + qn, 0.f);
+
+            for (size_t k0 = 0; k0 < keysLen; k0 += kBlockSize) {
+                const size_t kn = std::min(kBlockSize, keysLen - k0);
+                for (size_t i = 0; i < qn; i++) {
+                    const float* query = scaledQueries + i * headSize;
+                    if (keysTransposed) {
+                        std::fill(scores, scores + kn, 0.f);
+                        for (size_t d = 0; d < headSize; d++) {
+                            const float qd = query[d];
+                            const T* keysRow = k + d * keysLen + k0;
+                            for (size_t j = 0; j < kn; j++)
+                                scores[j] += qd * static_cast<float>(keysRow[j]);
+                        }
+                    } else {
+                        for (size_t j = 0; j < kn; j++) {
+                            const T* key = k + (k0 + j) * headSize;
+                            float score = 0.f;
+                            for (size_t d = 0; d < headSize; d++)
+                                score += query[d] * static_cast<float>(key[d]);
+                            scores[j] = score;
+                        }
+                    }
+                    if (m) {
+                        const T* maskRow = m + i * maskRowStride + k0 * maskColStride;
+                        for (size_t j = 0; j < kn; j++)
+                            scores[j] += static_cast<float>(maskRow[j * maskColStride]);
+                    }
+
+                    // online softmax: previous accumulators are rescaled to the new running max
+                    const float blockMax = *std::max_element(scores, scores + kn);
+                    const float newMax = std::max(rowMax[i], blockMax);
+                    if (newMax == -std::numeric_limits<float>::infinity())
+                        continue;
+                    float* accRow = acc + i * valuesHeadSize;
+                    const float correction = std::exp(rowMax[i] - newMax);
+                    if (correction != 1.f) {
+                        for (size_t e = 0; e < valuesHeadSize; e++)
+                            accRow[e] *= correction;
+                        rowSum[i] *= correction;
+                    }
+                    float blockSum = 0.f;
+                    for (size_t j = 0; j < kn; j++) {
+                        const float p = std::exp(scores[j] - newMax);
+                        blockSum += p;
+                        const T* value = v + (k0 + j) * valuesHeadSize;
+                        for (size_t e = 0; e < valuesHeadSize; e++)
+                            accRow[e] += p * static_cast<float>(value[e]);
+                    }
+                    rowSum[i] += blockSum;
+                    rowMax[i] = newMax;
+                }
+            }
+
+            T* out = dst + (b * queriesLen + q0) * valuesHeadSize;
+            for (size_t i = 0; i < qn; i++) {
+                const float norm = rowSum[i] > 0.f ? 1.f / rowSum[i] : 0.f;
+                for (size_t e = 0; e < valuesHeadSize; e++)
+                    out[i * valuesHeadSize + e] = static_cast<T>(acc[i * valuesHeadSize + e] * norm);
+            }
+        }
+    });
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    AttentionContext ctx = { *this };
+    OV_SWITCH(MKLDNNPlugin, AttentionExecute, ctx, dataPrecision,
+              OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t));
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention)
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Fused softmax(scale * Q * K^T + mask) * V.
+ * Queries are processed by blocks, keys and values are streamed by blocks which stay in cache
+ * while they are applied to all queries of the block. Softmax is computed online (running max and sum),
+ * so the [Lq x Lk] scores tensor is never materialized.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                        MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+
+    void prepareParams() override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void attention();
+
+    struct AttentionContext {
+        MKLDNNScaledDotProductAttentionNode& node;
+    };
+
+    template<typename T>
+    struct AttentionExecute {
+        void operator()(AttentionContext& ctx) {
+            ctx.node.attention<T>();
+        }
+    };
+
+    static constexpr size_t QUERIES_PORT = 0;
+    static constexpr size_t KEYS_PORT = 1;
+    static constexpr size_t VALUES_PORT = 2;
+    static constexpr size_t MASK_PORT = 3;
+
+    static constexpr size_t queriesBlockSize = 32;
+    static constexpr size_t keysBlockSize = 256;
+
+    float scale = 1.f;
+    bool keysTransposed = false;
+    bool withMask = false;
+
+    size_t batch = 1;
+    size_t queriesLen = 0;
+    size_t keysLen = 0;
+    size_t headSize = 0;
+    size_t valuesHeadSize = 0;
+
+    // mask is broadcasted to [B1, ..., Bn, Lq, Lk], strides of broadcasted dimensions are zero
+    std::vector<size_t> maskBatchOffsets;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    // per-thread accumulators, running max and sum, scores of the keys block and scaled queries
+    std::vector<float> scratch;
+    size_t threadScratchSize = 0;
+
+    InferenceEngine::Precision dataPrecision;
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
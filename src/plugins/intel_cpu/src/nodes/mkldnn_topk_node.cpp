@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 
 #include <ngraph/opsets/opset1.hpp>
@@ -10,6 +11,8 @@
 #include "ie_parallel.hpp"
 #include "mkldnn_topk_node.h"
 #include "utils/general_utils.h"
+#include "utils/bfloat16.hpp"
+#include <openvino/cc/selective_build.h>
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -18,6 +21,94 @@
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+
+// the axis is split between threads only if every thread gets at least this number of elements
+const int minSplitChunk = 4096;
+// bounded heap is used if k is much less than the axis, otherwise all the elements are partitioned
+const int heapRatio = 8;
+
+template <typename T>
+struct TopKItem {
+    T value;
+    int index;
+};
+
+template <typename T>
+inline bool isNaN(const T&) {
+    return false;
+}
+
+inline bool isNaN(const float& value) {
+    return std::isnan(value);
+}
+
+inline bool isNaN(const bfloat16_t& value) {
+    return std::isnan(static_cast<float>(value));
+}
+
+// Lower index goes first for equal values as in the reference implementation,
+// so the result doesn't depend on the selection strategy and the number of threads.
+// NaN is greater than any value, so it ranks highest for max and lowest for min: without that
+// the comparator is not a strict weak ordering and sort, nth_element and heap functions are undefined.
+template <typename T, template <typename> class Compare>
+struct TopKItemBetter {
+    bool operator()(const TopKItem<T>& a, const TopKItem<T>& b) const {
+        const bool aIsNaN = isNaN(a.value);
+        const bool bIsNaN = isNaN(b.value);
+        if (aIsNaN != bIsNaN)
+            return Compare<int>()(aIsNaN, bIsNaN);
+        if (!aIsNaN) {
+            if (Compare<T>()(a.value, b.value))
+                return true;
+            if (Compare<T>()(b.value, a.value))
+                return false;
+        }
+        return a.index < b.index;
+    }
+};
+
+inline bool useHeap(int n, int k) {
+    return static_cast<int64_t>(k) * heapRatio <= n;
+}
+
+// moves the best k of n items to the beginning, returns the number of the selected items
+template <typename T, typename Better>
+int selectItems(TopKItem<T>* items, int n, int k, const Better& better) {
+    if (k >= n)
+        return n;
+    std::nth_element(items, items + k - 1, items + n, better);
+    return k;
+}
+
+// selects the best k elements of [begin, end) range of the strided slice into items,
+// items should have room for the whole range unless useHeap() is true
+template <typename T, typename Better>
+int selectSlice(const T* src, size_t stride, int begin, int end, int k, TopKItem<T>* items, const Better& better) {
+    const int n = end - begin;
+    if (!useHeap(n, k)) {
+        for (int i = 0; i < n; i++)
+            items[i] = {src[(begin + i) * stride], begin + i};
+        return selectItems(items, n, k, better);
+    }
+
+    // the worst of the selected items is on the top of the heap, so most of the elements are rejected by one comparison
+    for (int i = 0; i < k; i++)
+        items[i] = {src[(begin + i) * stride], begin + i};
+    std::make_heap(items, items + k, better);
+    for (int i = begin + k; i < end; i++) {
+        const TopKItem<T> item = {src[i * stride], i};
+        if (better(item, items[0])) {
+            std::pop_heap(items, items + k, better);
+            items[k - 1] = item;
+            std::push_heap(items, items + k, better);
+        }
+    }
+    return k;
+}
+
+}  // namespace
+
 bool MKLDNNTopKNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto topKOp = ngraph::as_type_ptr<const ngraph::op::v1::TopK>(op);
@@ -59,27 +150,80 @@ void MKLDNNTopKNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    dataPrecision = getOriginalInputPrecisionAtPort(TOPK_DATA);
+    // i32 values can't be distinguished from indices if there is the only output
+    if (!one_of(dataPrecision, Precision::FP32, Precision::BF16, Precision::I32) ||
+        (dataPrecision == Precision::I32 && outputShapes.size() != 2))
+        dataPrecision = Precision::FP32;
+
     std::vector<PortConfigurator> outDataConf;
     outDataConf.reserve(outputShapes.size());
-    outDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
+    outDataConf.emplace_back(LayoutType::ncsp, dataPrecision);
     for (int i = 1; i < outputShapes.size(); ++i)
         outDataConf.emplace_back(LayoutType::ncsp, Precision::I32);
 
-    addSupportedPrimDesc({{LayoutType::ncsp, Precision::FP32},
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                           {LayoutType::ncsp, Precision::I32}},
                          outDataConf,
                          impl_desc_type::ref_any);
 }
 
+template <typename T>
+void MKLDNNTopKNode::topk_exec(const T* src_data, T* dst_data, int* dst_idx, const VectorDims& in_dims) {
+    if (mode_max)
+        topk_select<T, std::greater>(src_data, dst_data, dst_idx, 0);
+    else
+        topk_select<T, std::less>(src_data, dst_data, dst_idx, 0);
+}
+
+template <>
+void MKLDNNTopKNode::topk_exec<float>(const float* src, float* dst_data, int* dst_idx, const VectorDims& in_dims) {
+    // vectorized kernels process a whole slice in a thread, so they are not used if the axis is split between threads
+    if (use_axis_split()) {
+        if (mode_max)
+            topk_select<float, std::greater>(src, dst_data, dst_idx, 0);
+        else
+            topk_select<float, std::less>(src, dst_data, dst_idx, 0);
+        return;
+    }
+
+    const bool is_last_dim = after_num == 1;
+    if (src_k == 1) {
+        if (is_last_dim) {
+            if (mode_max)
+                top1<std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                top1<std::less>(src, dst_data, dst_idx, in_dims);
+        } else {
+            if (mode_max)
+                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+        }
+    } else {
+        if (is_last_dim) {
+            if (mode_max)
+                topk_select<float, std::greater>(src, dst_data, dst_idx, 0);
+            else
+                topk_select<float, std::less>(src, dst_data, dst_idx, 0);
+        } else {
+            if (mode_max)
+                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
+            else
+                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
+        }
+    }
+}
+
 void MKLDNNTopKNode::execute(mkldnn::stream strm) {
-    const float *src = reinterpret_cast<const float *>(getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr());
+    const void *src = getParentEdgeAt(TOPK_DATA)->getMemoryPtr()->GetPtr();
     src_k = reinterpret_cast<int *>(getParentEdgeAt(TOPK_K)->getMemoryPtr()->GetPtr())[0];
-    float* dst_data = nullptr;
+    void* dst_data = nullptr;
     int* dst_idx = nullptr;
 
     if (outputShapes.size() == 1) {
-        if (getOriginalOutputPrecisionAtPort(0) == Precision::FP32) {
-            dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+        if (getOriginalOutputPrecisionAtPort(0) == dataPrecision) {
+            dst_data = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr();
         } else {
             dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
         }
@@ -90,7 +234,7 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
             IE_THROW() << errorMsg;
         }
     } else if (outputShapes.size() == 2) {
-        dst_data = reinterpret_cast<float *>(getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr());
+        dst_data = getChildEdgesAtPort(TOPK_VALUE)[0]->getMemoryPtr()->GetPtr();
         const VectorDims& dst_data_dims = getChildEdgesAtPort(TOPK_VALUE)[0]->getMemory().getStaticDims();
 
         dst_idx = reinterpret_cast<int *>(getChildEdgesAtPort(TOPK_INDEX)[0]->getMemoryPtr()->GetPtr());
@@ -110,43 +254,15 @@ void MKLDNNTopKNode::execute(mkldnn::stream strm) {
     if (in_dims[axis] < static_cast<size_t>(src_k))
         src_k = in_dims[axis];
 
-    bool is_last_dim = false;
-    for (int j = in_dims.size() - 1; j >= 0; j--) {
-        if (in_dims[j] != 1) {
-            if (static_cast<size_t>(j) == axis)
-                is_last_dim = true;
-            break;
-        }
-    }
-
     dim = static_cast<int>(in_dims[axis]);
     before_num = count(in_dims, 0, axis);
+    after_num = count(in_dims, axis + 1, in_dims.size());
 
-    if (src_k == 1) {
-        if (is_last_dim) {
-            if (mode_max)
-                top1<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                top1_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                top1_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
-    } else {
-        if (is_last_dim) {
-            if (mode_max)
-                topk<std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk<std::less>(src, dst_data, dst_idx, in_dims);
-        } else {
-            if (mode_max)
-                topk_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx, in_dims);
-            else
-                topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
-        }
-    }
+    TopKContext ctx = {this, src, dst_data, dst_idx, in_dims};
+    OV_SWITCH(MKLDNNPlugin, TopKExecute, ctx, dataPrecision,
+              OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t),
+              OV_CASE(Precision::I32, int32_t))
 }
 
 bool MKLDNNTopKNode::created() const {
@@ -172,7 +288,6 @@ std::vector<VectorDims> MKLDNNTopKNode::shapeInfer() const {
 
 template <class Compare1, template <typename> class Compare2>
 void MKLDNNTopKNode::top1_axis(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
-    int after_num = count(in_dims, axis + 1, in_dims.size());
     int first_index = 0;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -241,7 +356,6 @@ void MKLDNNTopKNode::top1(const float* src_data, float* dst_data, int* dst_idx,
 
 template <class Compare1, template <typename> class Compare2>
 void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
-    int after_num = count(in_dims, axis + 1, in_dims.size());
     int first_index = 0;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
@@ -345,126 +459,76 @@ void MKLDNNTopKNode::topk_axis(const float* src_data, float* dst_data, int* dst_
             first_index = after_num / block_size * block_size;
         }
 #endif
-    int rest = after_num - first_index;
-    parallel_for2d(before_num, rest, [&](int i0, int i1) {
-        std::vector<float> max_values(src_k + 1);
-        std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
-        int tmp_index;
-        int s_index = i0 * dim * after_num + first_index + i1;
+    topk_select<float, Compare2>(src_data, dst_data, dst_idx, first_index);
+}
 
-        auto swap_func = [&](int index1, int index2) {
-            tmp_value = max_values[index1];
-            max_values[index1] = max_values[index2];
-            max_values[index2] = tmp_value;
+bool MKLDNNTopKNode::use_axis_split() const {
+    // there are not enough slices to load all the threads, the axis is long enough to be split between them
+    return before_num * after_num < parallel_get_max_threads() && dim >= 2 * minSplitChunk;
+}
 
-            tmp_index = max_indexes[index1];
-            max_indexes[index1] = max_indexes[index2];
-            max_indexes[index2] = tmp_index;
-        };
+template <typename T, template <typename> class Compare>
+void MKLDNNTopKNode::topk_select(const T* src_data, T* dst_data, int* dst_idx, int first_column) {
+    using Item = TopKItem<T>;
+    const TopKItemBetter<T, Compare> better;
+    const int columns = after_num - first_column;
+    const int slices = before_num * columns;
+    if (slices <= 0 || src_k <= 0)
+        return;
 
-        for (int i2 = 0; i2 < src_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index += after_num;
-        }
-        for (int i2 = 0; i2 < src_k - 1; i2++) {
-            for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
-                }
-            }
-        }
-        for (int i2 = src_k; i2 < dim; i2++) {
-            max_values[src_k] = src_data[s_index];
-            max_indexes[src_k] = i2;
-            for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare2<float>()(max_values[i3], max_values[i3 - 1]))
-                    swap_func(i3, i3 - 1);
-                else
-                    break;
-            }
-            s_index += after_num;
-        }
-        if (!sort_value) {
-            for (int i2 = 0; i2 < src_k - 1; i2++) {
-                for (int i3 = src_k - 1; i3 > i2; i3--) {
-                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
-                    }
-                }
-            }
-        }
+    auto src_offset = [&](int slice) {
+        return static_cast<size_t>(slice / columns) * dim * after_num + first_column + slice % columns;
+    };
+    auto dst_offset = [&](int slice) {
+        return static_cast<size_t>(slice / columns) * src_k * after_num + first_column + slice % columns;
+    };
+    auto store = [&](Item* items, int selected, size_t offset) {
+        if (sort_value)
+            std::sort(items, items + selected, better);
+        else
+            std::sort(items, items + selected, [](const Item& a, const Item& b) { return a.index < b.index; });
         if (dst_data) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_data[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_values[i2];
+            for (int i = 0; i < selected; i++)
+                dst_data[offset + i * after_num] = items[i].value;
         }
         if (dst_idx) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_idx[i0 * src_k * after_num + i2 * after_num + first_index + i1] = max_indexes[i2];
-        }
-    });
-}
-
-template <template <typename> class Compare>
-void MKLDNNTopKNode::topk(const float* src_data, float* dst_data, int* dst_idx, VectorDims in_dims) {
-    parallel_for(before_num, [&](int i0) {
-        std::vector<float> max_values(src_k + 1);
-        std::vector<int> max_indexes(src_k + 1);
-        float tmp_value;
-        int tmp_index;
-        int s_index = i0 * dim;
-
-        auto swap_func = [&](int index1, int index2) {
-            tmp_value = max_values[index1];
-            max_values[index1] = max_values[index2];
-            max_values[index2] = tmp_value;
-
-            tmp_index = max_indexes[index1];
-            max_indexes[index1] = max_indexes[index2];
-            max_indexes[index2] = tmp_index;
-        };
-
-        for (int i2 = 0; i2 < src_k; i2++) {
-            max_values[i2] = src_data[s_index];
-            max_indexes[i2] = i2;
-            s_index++;
+            for (int i = 0; i < selected; i++)
+                dst_idx[offset + i * after_num] = items[i].index;
         }
-        for (int i2 = 0; i2 < src_k - 1; i2++) {
-            for (int i3 = src_k - 1; i3 > i2; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1])) {
-                    swap_func(i3, i3 - 1);
-                }
-            }
-        }
-        for (int i2 = src_k; i2 < dim; i2++) {
-            max_values[src_k] = src_data[s_index];
-            max_indexes[src_k] = i2;
-            for (int i3 = src_k; i3 > 0; i3--) {
-                if (Compare<float>()(max_values[i3], max_values[i3 - 1]))
-                    swap_func(i3, i3 - 1);
-                else
-                    break;
-            }
-            s_index++;
-        }
-        if (!sort_value) {
-            for (int i2 = 0; i2 < src_k - 1; i2++) {
-                for (int i3 = src_k - 1; i3 > i2; i3--) {
-                    if (std::greater<int>()(max_indexes[i3 - 1], max_indexes[i3])) {
-                        swap_func(i3, i3 - 1);
-                    }
-                }
+    };
+
+    const int threads = parallel_get_max_threads();
+    const int chunks = use_axis_split() ? std::min(threads, dim / std::max(minSplitChunk, 4 * src_k)) : 1;
+    if (chunks > 1) {
+        // chunks of the slice are selected in parallel, then the best of their candidates are selected
+        const int chunk = div_up(dim, chunks);
+        std::vector<Item> items(static_cast<size_t>(chunk) * chunks);
+        std::vector<int> selected(chunks);
+        for (int slice = 0; slice < slices; slice++) {
+            const T* src = src_data + src_offset(slice);
+            parallel_for(chunks, [&](int c) {
+                const int begin = c * chunk;
+                selected[c] = selectSlice(src, after_num, begin, std::min(dim, begin + chunk), src_k, &items[begin], better);
+            });
+            int candidates = 0;
+            for (int c = 0; c < chunks; c++) {
+                std::copy(items.begin() + c * chunk, items.begin() + c * chunk + selected[c], items.begin() + candidates);
+                candidates += selected[c];
             }
+            store(items.data(), selectItems(items.data(), candidates, src_k, better), dst_offset(slice));
         }
-        if (dst_data) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_data[i0 * src_k + i2] = max_values[i2];
-        }
-        if (dst_idx) {
-            for (int i2 = 0; i2 < src_k; i2++)
-                dst_idx[i0 * src_k + i2] = max_indexes[i2];
-        }
+        return;
+    }
+
+    // scratch buffers are allocated once for all the slices processed by a thread
+    const size_t slice_items = useHeap(dim, src_k) ? src_k : dim;
+    std::vector<Item> items(slice_items * threads);
+    parallel_nt(threads, [&](const int ithr, const int nthr) {
+        Item* thread_items = &items[slice_items * ithr];
+        for_1d(ithr, nthr, slices, [&](int slice) {
+            const int selected = selectSlice(src_data + src_offset(slice), after_num, 0, dim, src_k, thread_items, better);
+            store(thread_items, selected, dst_offset(slice));
+        });
     });
 }
 
@@ -76,10 +76,31 @@ public:
     template<class Compare1, template<typename> class Compare2>
     void topk_axis(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
 
-    template<template<typename> class Compare>
-    void topk(const float *src_data, float *dst_data, int *dst_idx, InferenceEngine::SizeVector in_dims);
+    template<typename T, template<typename> class Compare>
+    void topk_select(const T *src_data, T *dst_data, int *dst_idx, int first_column);
+
+    template<typename T>
+    void topk_exec(const T *src_data, T *dst_data, int *dst_idx, const InferenceEngine::SizeVector &in_dims);
 
 private:
+    struct TopKContext {
+        MKLDNNTopKNode* node;
+        const void* src_data;
+        void* dst_data;
+        int* dst_idx;
+        const InferenceEngine::SizeVector &in_dims;
+    };
+
+    template<typename T>
+    struct TopKExecute {
+        void operator()(TopKContext & ctx) {
+            ctx.node->topk_exec<T>(reinterpret_cast<const T*>(ctx.src_data), reinterpret_cast<T*>(ctx.dst_data),
+                                   ctx.dst_idx, ctx.in_dims);
+        }
+    };
+
+    bool use_axis_split() const;
+
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
     const size_t TOPK_VALUE = 0;
@@ -93,6 +114,9 @@ private:
 
     int dim = 0;
     int before_num = 0;
+    int after_num = 0;
+
+    InferenceEngine::Precision dataPrecision = InferenceEngine::Precision::FP32;
 
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
@@ -4,26 +4,94 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ratio>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Per node execution statistics.
+ * Besides the total duration, iterations are accumulated into log2 buckets (bucket i holds durations in [2^(i-1), 2^i) us),
+ * so tail latency of a particular node can be estimated without storing every sample.
+ * Counters are written only by the thread executing the graph, but may be read concurrently by GetMetric,
+ * so relaxed atomics are used to avoid torn reads without adding RMW overhead on the execution path.
+ */
 class PerfCount {
-    uint64_t total_duration;
-    uint32_t num;
+public:
+    static constexpr size_t histogramSize = 32;
+
+private:
+    std::atomic<uint64_t> total_duration;
+    std::atomic<uint32_t> num;
+    std::atomic<uint64_t> max_duration;
+    std::array<std::atomic<uint32_t>, histogramSize> histogram;
+
+    std::atomic<uint32_t> prepare_params_num;
+    std::atomic<uint64_t> prepare_params_duration;
+    std::atomic<uint32_t> cache_misses;
 
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    template <typename T>
+    static void add(std::atomic<T>& counter, T value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    static T get(const std::atomic<T>& counter) {
+        return counter.load(std::memory_order_relaxed);
+    }
+
 public:
-    PerfCount(): total_duration(0), num(0) {}
+    PerfCount(): total_duration(0), num(0), max_duration(0), prepare_params_num(0), prepare_params_duration(0), cache_misses(0) {
+        for (auto& bucket : histogram)
+            bucket.store(0, std::memory_order_relaxed);
+    }
 
     std::chrono::duration<double, std::milli> duration() const {
         return __finish - __start;
     }
 
-    uint64_t avg() const { return (num == 0) ? 0 : total_duration / num; }
+    uint64_t avg() const { return (get(num) == 0) ? 0 : get(total_duration) / get(num); }
+    uint32_t count() const { return get(num); }
+    uint64_t max() const { return get(max_duration); }
+    uint32_t bucket(size_t i) const { return get(histogram[i]); }
+
+    /**
+     * @brief Estimates percentile of the node execution time as upper bound of the corresponding bucket (in microseconds)
+     */
+    uint64_t percentile(double p) const {
+        const uint32_t total = get(num);
+        if (total == 0)
+            return 0;
+        const uint64_t rank = static_cast<uint64_t>(total * p / 100.0);
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < histogramSize; i++) {
+            accumulated += get(histogram[i]);
+            if (accumulated > rank)
+                return std::min<uint64_t>(bucketUpperBound(i), get(max_duration));
+        }
+        return get(max_duration);
+    }
+
+    static uint64_t bucketUpperBound(size_t i) {
+        return (static_cast<uint64_t>(1) << i) - 1;
+    }
+
+    uint32_t prepareParamsCount() const { return get(prepare_params_num); }
+    uint64_t prepareParamsDuration() const { return get(prepare_params_duration); }
+    uint32_t cacheMisses() const { return get(cache_misses); }
+
+    void addPrepareParams(std::chrono::high_resolution_clock::time_point start, uint32_t misses) {
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        add<uint32_t>(prepare_params_num, 1);
+        add<uint64_t>(prepare_params_duration, duration);
+        add<uint32_t>(cache_misses, misses);
+    }
 
 private:
     void start_itr() {
@@ -32,8 +100,16 @@ private:
 
     void finish_itr() {
         __finish = std::chrono::high_resolution_clock::now();
-        total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
-        num++;
+        const uint64_t duration = std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        add<uint64_t>(total_duration, duration);
+        add<uint32_t>(num, 1);
+        if (duration > get(max_duration))
+            max_duration.store(duration, std::memory_order_relaxed);
+
+        size_t idx = 0;
+        while (idx < histogramSize - 1 && (duration >> idx) != 0)
+            idx++;
+        add<uint32_t>(histogram[idx], 1);
     }
 
     friend class PerfHelper;
@@ -16,12 +16,15 @@
 #include <memory>
 #include <utility>
 #include <limits>
+#include <chrono>
+#include <future>
 
 #include <ie_common.h>
 #include <legacy/graph_tools.hpp>
 #include <legacy/net_pass.h>
 #include <debug.h>
 #include <gna/gna_config.hpp>
+#include <threading/ie_executor_manager.hpp>
 #include "gna_plugin_config.hpp"
 #include "gna_plugin.hpp"
 #include "optimizer/gna_pass_manager.hpp"
@@ -343,6 +346,15 @@ GNAPlugin::GNAPlugin(const std::map<std::string, std::string>& configMap) {
     SetConfig(configMap);
 }
 
+GNAPlugin::~GNAPlugin() {
+    // software requests still running in executor use RW segment of this instance
+    for (auto& request : fpRequests) {
+        if (request.valid()) {
+            request.wait();
+        }
+    }
+}
+
 void GNAPlugin::Init() {
     OV_ITT_SCOPED_TASK(itt::domains::GNAPlugin, "Init");
     dnn = std::make_shared<backend::AMIntelDNN>(backend::AMIntelDNN());
@@ -897,7 +909,7 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
     graphCompiler.fillMemoryConnections(memoryPairs);
 
     if (!graphCompiler.memory_connection.empty() && gnaFlags->gna_lib_async_threads_num != 1) {
-        // TODO: check if updating the number of threads is needed for sw_fp32
+        // memory layers keep the state in RW segment, so it cannot be duplicated for parallel requests
         gnaFlags->gna_lib_async_threads_num = 1;
         if (!gnaFlags->sw_fp32)
             InitGNADevice();
@@ -1016,11 +1028,17 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         dnn->InitGNAStruct(&std::get<0>(gnaModels.front())->obj, effectiveGnaCompileTarget);
     }
 
+    if (gnaFlags->sw_fp32) {
+        fpRuntimes.push_back(std::make_shared<runtime::FP>(dnn));
+    }
+
     // creating same gna RW segment for parallel infer requests
     for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
-        gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
-        // this can be improved by just copy all structures, but we are too lazy
-        dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj, effectiveGnaCompileTarget);
+        if (!gnaFlags->sw_fp32) {
+            gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
+            // this can be improved by just copy all structures, but we are too lazy
+            dnn->InitGNAStruct(&std::get<0>(gnaModels.back())->obj, effectiveGnaCompileTarget);
+        }
         // relocate rw pointers to new offset
         auto basePtr = reinterpret_cast<uint8_t*>(pParallelExecutionData) + rwSegmentSize * (i - 1);
 
@@ -1042,6 +1060,29 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
             relocate(output.ptrs[i], output.ptrs[0]);
         }
 
+        if (gnaFlags->sw_fp32) {
+            // floating point runtime works on copy of components with activations moved to own RW segment,
+            // constant inputs and weights stay shared between requests
+            auto isReadWrite = [this](void * ptr) {
+                auto rwBegin = reinterpret_cast<uint8_t *>(gnamem->getBasePtr());
+                return ptr >= rwBegin && ptr < rwBegin + rwSegmentSize;
+            };
+            auto components = dnn->component;
+            for (auto &component : components) {
+                if (isReadWrite(component.ptr_inputs)) {
+                    relocate(component.ptr_inputs, component.ptr_inputs);
+                }
+                if (isReadWrite(component.ptr_outputs)) {
+                    relocate(component.ptr_outputs, component.ptr_outputs);
+                }
+                if (component.operation == kDnnRecurrentOp && isReadWrite(component.op.recurrent.ptr_feedbacks)) {
+                    relocate(component.op.recurrent.ptr_feedbacks, component.op.recurrent.ptr_feedbacks);
+                }
+            }
+            fpRuntimes.push_back(std::make_shared<runtime::FP>(dnn, std::move(components)));
+            continue;
+        }
+
         for (int j = 0; j != std::get<0>(gnaModels.front())->obj.NumberOfOperations; j++) {
             auto & gnaOperation = std::get<0>(gnaModels[i])->obj.Operations[j];
             relocate(const_cast<Gna2Tensor*>(gnaOperation.Operands[0])->Data, gnaOperation.Operands[0]->Data);
@@ -1049,6 +1090,14 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
         }
     }
 
+    if (gnaFlags->sw_fp32 && gnaFlags->gna_lib_async_threads_num > 1) {
+        fpExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            InferenceEngine::IStreamsExecutor::Config{"GNASwFp32Executor",
+                                                      static_cast<int>(gnaFlags->gna_lib_async_threads_num),
+                                                      0 /*default threads per stream*/,
+                                                      InferenceEngine::IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
     // calculating input orientation without memory layers, since their orientation not changed during infer right now
     std::unordered_map<string, std::vector<string>> skippedLayers;
 
@@ -1124,7 +1173,12 @@ void GNAPlugin::LoadNetwork(CNNNetwork & _network) {
 
 void GNAPlugin::createRequestConfigsForGnaModels() {
     if (!gnadevice || trivialTopology) {
-        gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        // every software request has own RW segment, see LoadNetwork
+        const auto requestsNum = (std::max)(fpRuntimes.size(), static_cast<size_t>(1));
+        for (size_t i = 0; i != requestsNum; i++) {
+            gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(FAKE_REQUEST_CONFIG_ID, -1, InferenceEngine::BlobMap()));
+        }
+        fpRequests.resize(requestsNum);
         return;
     }
     for (auto& model : gnaModels) {
@@ -1266,8 +1320,18 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     // If there is no gnadevice infer using reference FP32 transforamtions
     if (!gnadevice || trivialTopology) {
-        auto runtime = runtime::FP(dnn);
-        runtime.infer();
+        auto runtime = idx < fpRuntimes.size() ? fpRuntimes[idx] : std::make_shared<runtime::FP>(dnn);
+        if (fpExecutor) {
+            auto task = std::make_shared<std::packaged_task<void()>>([runtime] {
+                runtime->infer();
+            });
+            fpRequests[idx] = task->get_future();
+            fpExecutor->run([task] {
+                (*task)();
+            });
+        } else {
+            runtime->infer();
+        }
         if (freeNnet != nnets.end()) {
             std::get<1>(*freeNnet) = 1;
         }
@@ -1312,6 +1376,17 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         if (waitStatus == GNA_REQUEST_PENDING) {
             return GNA_REQUEST_PENDING;
         }
+    } else if (request_idx < fpRequests.size() && fpRequests[request_idx].valid()) {
+        auto& fpRequest = fpRequests[request_idx];
+        if (fpRequest.wait_for(std::chrono::milliseconds(millisTimeout)) != std::future_status::ready) {
+            return GNA_REQUEST_PENDING;
+        }
+        try {
+            fpRequest.get();
+        } catch (...) {
+            std::get<1>(nnets[request_idx]) = -1;
+            throw;
+        }
     }
 
     std::get<1>(nnets[request_idx]) = -1;
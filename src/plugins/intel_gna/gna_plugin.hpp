@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <future>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
@@ -22,6 +23,8 @@
 #include "gna_graph_compiler.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_plugin_config.hpp"
+#include "runtime/gna_float_runtime.hpp"
+#include <threading/ie_istreams_executor.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <gna2-model-api.h>
 
@@ -46,6 +49,14 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     std::vector<std::tuple<dnn_ptr>> gnaModels;
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
 
+    /**
+     * @brief - floating point runtimes of parallel infer requests in GNA_SW_FP32 mode, each one works
+     * on own RW segment, and results of the requests being executed by fpExecutor
+     */
+    std::vector<std::shared_ptr<GNAPluginNS::runtime::FP>> fpRuntimes;
+    std::vector<std::future<void>> fpRequests;
+    InferenceEngine::IStreamsExecutor::Ptr fpExecutor;
+
     uint32_t activeLayerIndex = 0xffffffff;
     TranspositionInfoMap transpose_inputs_info;
     TranspositionInfoMap transpose_outputs_info;
@@ -78,6 +89,8 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
      */
     GNAPlugin();
 
+    ~GNAPlugin();
+
     std::string GetName() const noexcept override;
     void SetName(const std::string & pluginName) noexcept override;
 
@@ -6,9 +6,12 @@
 #include <limits>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
 #include <gna_plugin_log.hpp>
+#include <ie_parallel.hpp>
 
 #include "cnn.h"
+#include "sgemm_blocked.hpp"
 #include "backend/dnn_types.h"
 #include "backend/gna_limitations.hpp"
 #include "gna_lib_ver_selector.hpp"
@@ -37,15 +40,21 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++, input += convolutionStride, output += numberOfFilters) {
-        auto filter = filters;
-        for (uint32_t i = 0; i < numberOfFilters; i++, filter += filterSize) {
-            output[i] = biases[i];
-            for (uint32_t k = 0; k < filterSize; k++) {
-                output[i] += input[k] * filter[k];
-            }
+    // The convolution is computed as GEMM: output[J x F] = input windows[J x K] * filters^T[K x F],
+    // consecutive windows are rows of the input with leading dimension equal to the stride
+    std::vector<float> transposedFilters(filterSize * numberOfFilters);
+    for (uint32_t i = 0; i < numberOfFilters; i++) {
+        for (uint32_t k = 0; k < filterSize; k++) {
+            transposedFilters[k * numberOfFilters + i] = filters[i * filterSize + k];
         }
     }
+    for (uint32_t j = 0; j < numberOfOutputsPerFilter; j++) {
+        std::copy(biases, biases + numberOfFilters, output + j * numberOfFilters);
+    }
+    GNAPluginNS::runtime::XARCH::sgemm_blocked(numberOfOutputsPerFilter, numberOfFilters, filterSize,
+                                               input, convolutionStride,
+                                               transposedFilters.data(), numberOfFilters,
+                                               output, numberOfFilters);
 }
 
 namespace {
@@ -199,40 +208,6 @@ bool matchesPaddedArea(unsigned filterIndex, unsigned outputIndex, unsigned inpu
     return false;
 }
 
-float CNN2DFilter32SingleHWC(const float bias, const float* filter, const unsigned KH, const unsigned KW, const unsigned KC,
-    const float* image, const unsigned IH, const unsigned IW, const unsigned IC,
-    const unsigned oh, const unsigned ow, const unsigned oc,
-    const std::array<uint32_t, 2>& convStride,
-    const std::array<uint32_t, 2>& zeroPadding) {
-
-    const auto cSH = convStride[0];
-    const auto cSW = convStride[1];
-
-    const auto zPH = zeroPadding[0];
-    const auto zPW = zeroPadding[1];
-    float output = 0;
-    for (unsigned kh = 0; kh < KH; kh++) {
-        for (unsigned kw = 0; kw < KW; kw++) {
-            for (unsigned kc = 0; kc < KC; kc++) {
-                if (!matchesPaddedArea(kh, oh, IH, zPH, cSH) &&
-                    !matchesPaddedArea(kw, ow, IW, zPW, cSW)) {
-                    const auto ih = (cSH * oh + kh) - zPH;
-                    const auto iw = (cSW * ow + kw) - zPW;
-                    const auto ic = kc;
-                    const auto imageIndex = getQubeIndex(ih, iw, ic, IW, IC);
-                    const auto imageElement = image[imageIndex];
-                    const auto filterIndex = getQubeIndex(kh, kw, kc, KW, KC);
-                    const auto filterElement = filter[filterIndex];
-                    const auto product = imageElement * filterElement;
-                    output += product;
-                }
-            }
-        }
-    }
-    output += bias;
-    return output;
-}
-
 } // namespace
 
 void CNN2DFilter32(intel_dnn_component_t* component) {
@@ -263,20 +238,49 @@ void CNN2DFilter32(intel_dnn_component_t* component) {
     if (kc != IC) {
         THROW_GNA_EXCEPTION << "Depth of filter should be equal to input depth!" << layer_name;
     }
-    auto kernelIndex = 0;
+    const auto& convStride = component->op.conv2D.convStride;
+    const auto& zeroPadding = component->op.conv2D.zeroPadding;
+
+    // The convolution is computed as GEMM over the flattened receptive fields of the output rows:
+    // output[OW x OC] = patches[OW x P] * filters^T[P x OC], where P = kh * kw * kc.
+    // Elements of the padded area are zero in the patches.
+    const auto P = kh * kw * kc;
+    // kernel padded to 16B = 4 * sizeof(float)
+    const auto kernelStride = ALIGN(P, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
+    std::vector<float> transposedFilters(P * OC);
     for (unsigned oc = 0; oc < OC; oc++) {
+        for (unsigned p = 0; p < P; p++) {
+            transposedFilters[p * OC + oc] = ptr_filters[oc * kernelStride + p];
+        }
+    }
+
+    std::vector<float> patches(static_cast<size_t>(OW) * P);
+    for (unsigned oh = 0; oh < OH; oh++) {
+        InferenceEngine::parallel_for(OW, [&](size_t ow) {
+            float* patch = patches.data() + ow * P;
+            for (unsigned y = 0; y < kh; y++) {
+                for (unsigned x = 0; x < kw; x++, patch += kc) {
+                    if (matchesPaddedArea(y, oh, IH, zeroPadding[0], convStride[0]) ||
+                        matchesPaddedArea(x, ow, IW, zeroPadding[1], convStride[1])) {
+                        std::fill(patch, patch + kc, 0.f);
+                    } else {
+                        const auto ih = (convStride[0] * oh + y) - zeroPadding[0];
+                        const auto iw = (convStride[1] * ow + x) - zeroPadding[1];
+                        const auto image = ptr_inputs + getQubeIndex(ih, static_cast<uint32_t>(iw), 0u, IW, IC);
+                        std::copy(image, image + kc, patch);
+                    }
+                }
+            }
+        });
+
+        float* output = ptr_outputs + getQubeIndex(oh, 0u, 0u, OW, OC);
+        std::fill(output, output + OW * OC, 0.f);
+        GNAPluginNS::runtime::XARCH::sgemm_blocked(OW, OC, P, patches.data(), P, transposedFilters.data(), OC, output, OC);
         for (unsigned ow = 0; ow < OW; ow++) {
-            for (unsigned oh = 0; oh < OH; oh++) {
-                const auto outputIndex = getQubeIndex(oh, ow, oc, OW, OC);
-                ptr_outputs[outputIndex] = CNN2DFilter32SingleHWC(*(ptr_biases + oc), ptr_filters + kernelIndex, kh, kw, kc,
-                    ptr_inputs, IH, IW, IC,
-                    oh, ow, oc,
-                    component->op.conv2D.convStride,
-                    component->op.conv2D.zeroPadding);
+            for (unsigned oc = 0; oc < OC; oc++) {
+                output[ow * OC + oc] += ptr_biases[oc];
             }
         }
-        // kernel padded to 16B = 4 * sizeof(float)
-        kernelIndex += ALIGN(kh * kw * kc, GNAPluginNS::GNALimitations::convEachKernelByteAlignment / sizeof(float));
     }
 }
 
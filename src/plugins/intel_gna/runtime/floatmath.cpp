@@ -1,13 +1,14 @@
 // Copyright (C) 2018-2022 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines (for reference)
 //
 
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "sgemm_blocked.hpp"
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +28,14 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                for (j = 0; j < N; j++) {
+                    C[i * ldc + j] = 0;
                 }
-                C[i * ldc + j] = sum;
             }
         }
+        GNAPluginNS::runtime::XARCH::sgemm_blocked(M, N, K, A, lda, B, ldb, C, ldc);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
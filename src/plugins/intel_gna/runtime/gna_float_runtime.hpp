@@ -3,6 +3,9 @@
 //
 
 #pragma once
+#include <memory>
+#include <utility>
+#include <vector>
 #include <backend/am_intel_dnn.hpp>
 
 namespace GNAPluginNS {
@@ -12,10 +15,18 @@ namespace runtime {
  */
 class FP {
     std::shared_ptr<backend::AMIntelDNN> dnn;
+    std::vector<intel_dnn_component_t> components;
 
  public:
     FP(std::shared_ptr<backend::AMIntelDNN> dnn) : dnn(dnn) {
     }
+    /**
+     * @brief runtime executing own copy of dnn components, used by parallel infer requests
+     * which have inputs and outputs relocated to separate RW segments
+     */
+    FP(std::shared_ptr<backend::AMIntelDNN> dnn, std::vector<intel_dnn_component_t> components)
+        : dnn(dnn), components(std::move(components)) {
+    }
     virtual void infer();
 
     /**
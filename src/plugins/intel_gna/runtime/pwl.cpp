@@ -24,7 +24,10 @@
 #define TANH(num, in, out) vsTanh(num, in, out)
 #endif
 
+#include <ie_parallel.hpp>
+
 #include "pwl.h"
+#include "pwl_activations.hpp"
 #include "gna_plugin_log.hpp"
 #include "gna_slope_scale.h"
 #include "round_float_define.hpp"
@@ -849,6 +852,39 @@ void PwlDesign(const DnnActivation& activation_type,
     }
 }
 
+namespace {
+
+/**
+ * @brief Calls func(input, output, size) for contiguous parts of the given rows and columns range.
+ * The whole rows are processed as a single array split into chunks, the chunks or rows are processed in parallel.
+ */
+template <typename F>
+void PwlForEachSpan(const float *ptr_in, float *ptr_out, uint32_t num_columns,
+                    uint32_t num_row_start, uint32_t num_row_end,
+                    uint32_t num_col_start, uint32_t num_col_end, const F& func) {
+    constexpr size_t chunk_size = 4096;
+    if (num_col_start == 0 && num_col_end == num_columns - 1) {
+        const size_t offset = static_cast<size_t>(num_row_start) * num_columns;
+        const size_t size = static_cast<size_t>(num_row_end - num_row_start + 1) * num_columns;
+        const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+        if (num_chunks <= 1) {
+            func(ptr_in + offset, ptr_out + offset, size);
+            return;
+        }
+        InferenceEngine::parallel_for(num_chunks, [&](size_t chunk) {
+            const size_t begin = chunk * chunk_size;
+            func(ptr_in + offset + begin, ptr_out + offset + begin, (std::min)(chunk_size, size - begin));
+        });
+    } else {
+        InferenceEngine::parallel_for(num_row_end - num_row_start + 1, [&](size_t row) {
+            const size_t offset = (num_row_start + row) * num_columns + num_col_start;
+            func(ptr_in + offset, ptr_out + offset, num_col_end - num_col_start + 1);
+        });
+    }
+}
+
+}  // namespace
+
 void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     if (component->orientation_in == kDnnInterleavedOrientation) {  // subsets only supported in interleaved orientation
         PwlApply32(component, 0, num_subset_size - 1, 0, component->num_columns_in - 1);
@@ -866,28 +902,15 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
-    switch (transform->func_id.type) {
-        case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
-                }
-            }
-            break;
-        case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
-                }
-            }
-            break;
-        case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
-                }
-            }
-            break;
+    const auto type = transform->func_id.type;
+    if (GNAPluginNS::runtime::pwl_is_vectorized_activation(type)) {
+        PwlForEachSpan(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                       [type](const float *input, float *output, size_t size) {
+            GNAPluginNS::runtime::XARCH::pwl_apply_activation(type, input, output, size);
+        });
+        return;
+    }
+    switch (type) {
         case kActRelu:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
@@ -922,20 +945,6 @@ void PwlApply32(intel_dnn_component_t *component,
             }
             break;
         }
-        case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
-                }
-            }
-            break;
-        case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
-                }
-            }
-            break;
         case kActAbs:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
@@ -950,29 +959,16 @@ void PwlApply32(intel_dnn_component_t *component,
                 }
             }
             break;
-        case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
-                }
-            }
-            break;
-        case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
-                }
-            }
-            break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
+                PwlForEachSpan(ptr_in, ptr_out, num_columns, num_row_start, num_row_end, num_col_start, num_col_end,
+                               [&](const float *input, float *output, size_t size) {
+                    for (size_t j = 0; j < size; j++) {
+                        output[j] = pow(offset + scale * input[j], exponent);
                     }
-                }
+                });
             }
             break;
         case kActFakeQuantize: {
@@ -0,0 +1,155 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pwl_activations.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+inline float as_float(int32_t i) {
+    float f;
+    std::memcpy(&f, &i, sizeof(f));
+    return f;
+}
+
+inline int32_t as_int(float f) {
+    int32_t i;
+    std::memcpy(&i, &f, sizeof(i));
+    return i;
+}
+
+// Cephes single precision approximations, all conditions are expressed as selects to keep the loops vectorizable
+
+inline float exp_approx(float x) {
+    const float max_arg = 88.7228391116729996f;   // log(FLT_MAX)
+    const float min_arg = -103.972077083991796f;  // log(FLT_TRUE_MIN / 2)
+    const bool overflow = x > max_arg;
+    const bool underflow = x < min_arg;
+    x = (std::min)((std::max)(x, min_arg), max_arg);
+
+    // exp(x) = 2^n * exp(r), |r| <= ln(2) / 2
+    const float n = std::floor(x * 1.44269504088896341f + 0.5f);
+    float r = x - n * 0.693359375f;
+    r = r + n * 2.12194440e-4f;
+
+    const float z = r * r;
+    float y = 1.9875691500E-4f;
+    y = y * r + 1.3981999507E-3f;
+    y = y * r + 8.3334519073E-3f;
+    y = y * r + 4.1665795894E-2f;
+    y = y * r + 1.6666665459E-1f;
+    y = y * r + 5.0000001201E-1f;
+    y = y * z + r + 1.0f;
+
+    // 2^n is applied in two steps, so n in [-150, 128] doesn't overflow the exponent and gives denormals
+    const int32_t n1 = static_cast<int32_t>(n) / 2;
+    const int32_t n2 = static_cast<int32_t>(n) - n1;
+    y = y * as_float((n1 + 127) << 23) * as_float((n2 + 127) << 23);
+    y = overflow ? std::numeric_limits<float>::infinity() : y;
+    return underflow ? 0.0f : y;
+}
+
+inline float log_approx(float x) {
+    // denormals are scaled to normal range, non positive values are handled at the end
+    const bool denormal = x < std::numeric_limits<float>::min();
+    const float v = denormal ? x * 8388608.0f : x;
+
+    const int32_t bits = as_int(v);
+    float e = static_cast<float>(((bits >> 23) & 0xff) - 126) - (denormal ? 23.0f : 0.0f);
+    // mantissa in [0.5, 1)
+    float m = as_float((bits & 0x807fffff) | 0x3f000000);
+
+    const bool small = m < 0.707106781186547524f;
+    e = small ? e - 1.0f : e;
+    m = small ? m + m - 1.0f : m - 1.0f;
+
+    const float z = m * m;
+    float y = 7.0376836292E-2f;
+    y = y * m - 1.1514610310E-1f;
+    y = y * m + 1.1676998740E-1f;
+    y = y * m - 1.2420140846E-1f;
+    y = y * m + 1.4249322787E-1f;
+    y = y * m - 1.6668057665E-1f;
+    y = y * m + 2.0000714765E-1f;
+    y = y * m - 2.4999993993E-1f;
+    y = y * m + 3.3333331174E-1f;
+    y = y * m * z;
+    y = y - e * 2.12194440e-4f;
+    y = y - 0.5f * z;
+    float result = m + y + e * 0.693359375f;
+
+    result = x == std::numeric_limits<float>::infinity() ? x : result;
+    result = x == 0.0f ? -std::numeric_limits<float>::infinity() : result;
+    return x < 0.0f ? std::numeric_limits<float>::quiet_NaN() : result;
+}
+
+inline float tanh_approx(float x) {
+    const float ax = std::fabs(x);
+
+    // small arguments: odd polynomial, avoids cancellation in 1 - 2 / (exp(2x) + 1)
+    const float z = x * x;
+    float p = -5.70498872745E-3f;
+    p = p * z + 2.06390887954E-2f;
+    p = p * z - 5.37397155531E-2f;
+    p = p * z + 1.33314422036E-1f;
+    p = p * z - 3.33332819422E-1f;
+    const float small = p * z * x + x;
+
+    const float large = 1.0f - 2.0f / (exp_approx(ax + ax) + 1.0f);
+    return ax < 0.625f ? small : std::copysign(large, x);
+}
+
+inline float sigmoid_approx(float x) {
+    return 1.0f / (1.0f + exp_approx(-x));
+}
+
+template <typename F>
+inline void apply(const float* input, float* output, const size_t size, F f) {
+    for (size_t i = 0; i < size; i++) {
+        output[i] = f(input[i]);
+    }
+}
+
+}  // namespace
+
+void pwl_apply_activation(const DnnActivationType type, const float* input, float* output, const size_t size) {
+    switch (type) {
+    case kActSigmoid:
+        apply(input, output, size, [](float x) { return sigmoid_approx(x); });
+        break;
+    case kActTanh:
+        apply(input, output, size, [](float x) { return tanh_approx(x); });
+        break;
+    case kActExp:
+        apply(input, output, size, [](float x) { return exp_approx(x); });
+        break;
+    case kActLog:
+        apply(input, output, size, [](float x) { return log_approx(x); });
+        break;
+    case kActNegLog:
+        apply(input, output, size, [](float x) { return -log_approx(x); });
+        break;
+    case kActNegHalfLog:
+        apply(input, output, size, [](float x) { return -0.5f * log_approx(x); });
+        break;
+    case kActSoftSign:
+        apply(input, output, size, [](float x) { return x / (1.0f + std::fabs(x)); });
+        break;
+    default:
+        break;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
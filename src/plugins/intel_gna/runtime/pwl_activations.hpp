@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "backend/dnn_types.h"
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Returns true if the activation is supported by pwl_apply_activation
+ */
+inline bool pwl_is_vectorized_activation(const DnnActivationType type) {
+    switch (type) {
+    case kActSigmoid:
+    case kActTanh:
+    case kActExp:
+    case kActLog:
+    case kActNegLog:
+    case kActNegHalfLog:
+    case kActSoftSign:
+        return true;
+    default:
+        return false;
+    }
+}
+
+namespace XARCH {
+
+/**
+ * @brief Evaluates sigmoid, tanh, exp, log, neglog, neghalflog or softsign over a contiguous array.
+ * Transcendental functions are computed with single precision polynomial approximations (max error ~2 ulp)
+ * written without branches, so the loops are vectorized for the target instruction set.
+ */
+void pwl_apply_activation(const DnnActivationType type, const float* input, float* output, const size_t size);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
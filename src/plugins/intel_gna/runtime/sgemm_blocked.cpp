@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sgemm_blocked.hpp"
+
+#include <algorithm>
+
+#include "ie_parallel.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+// K is processed by blocks, so the B panel of a tile stays in L1 cache
+constexpr size_t kBlockK = 256;
+
+/**
+ * @brief Computes MR x NR tile of C. Loops have compile time bounds, so the compiler keeps the accumulators
+ * in vector registers of the target instruction set. Products are added in the order of k for every element.
+ */
+template <size_t MR, size_t NR>
+void tile_full(const size_t K, const float* A, const size_t lda, const float* B, const size_t ldb, float* C, const size_t ldc) {
+    float acc[MR][NR];
+    for (size_t r = 0; r < MR; r++) {
+        for (size_t j = 0; j < NR; j++) {
+            acc[r][j] = C[r * ldc + j];
+        }
+    }
+    for (size_t k = 0; k < K; k++) {
+        const float* b = B + k * ldb;
+        for (size_t r = 0; r < MR; r++) {
+            const float a = A[r * lda + k];
+            for (size_t j = 0; j < NR; j++) {
+                acc[r][j] += a * b[j];
+            }
+        }
+    }
+    for (size_t r = 0; r < MR; r++) {
+        for (size_t j = 0; j < NR; j++) {
+            C[r * ldc + j] = acc[r][j];
+        }
+    }
+}
+
+/**
+ * @brief Same as tile_full for the tiles on the matrix edges (mr <= MR, nr <= NR).
+ */
+template <size_t MR, size_t NR>
+void tile_edge(const size_t mr, const size_t nr, const size_t K,
+               const float* A, const size_t lda, const float* B, const size_t ldb, float* C, const size_t ldc) {
+    float acc[MR][NR];
+    for (size_t r = 0; r < mr; r++) {
+        for (size_t j = 0; j < nr; j++) {
+            acc[r][j] = C[r * ldc + j];
+        }
+    }
+    for (size_t k = 0; k < K; k++) {
+        const float* b = B + k * ldb;
+        for (size_t r = 0; r < mr; r++) {
+            const float a = A[r * lda + k];
+            for (size_t j = 0; j < nr; j++) {
+                acc[r][j] += a * b[j];
+            }
+        }
+    }
+    for (size_t r = 0; r < mr; r++) {
+        for (size_t j = 0; j < nr; j++) {
+            C[r * ldc + j] = acc[r][j];
+        }
+    }
+}
+
+template <size_t MR, size_t NR>
+void sgemm_tiles(const size_t M, const size_t N, const size_t K,
+                 const float* A, const size_t lda, const float* B, const size_t ldb, float* C, const size_t ldc) {
+    const size_t rowTiles = (M + MR - 1) / MR;
+    const size_t colTiles = (N + NR - 1) / NR;
+
+    InferenceEngine::parallel_for2d(rowTiles, colTiles, [&](size_t rt, size_t ct) {
+        const size_t i = rt * MR;
+        const size_t j = ct * NR;
+        const size_t mr = (std::min)(MR, M - i);
+        const size_t nr = (std::min)(NR, N - j);
+        for (size_t k = 0; k < K; k += kBlockK) {
+            const size_t kb = (std::min)(kBlockK, K - k);
+            const float* a = A + i * lda + k;
+            const float* b = B + k * ldb + j;
+            float* c = C + i * ldc + j;
+            if (mr == MR && nr == NR) {
+                tile_full<MR, NR>(kb, a, lda, b, ldb, c, ldc);
+            } else {
+                tile_edge<MR, NR>(mr, nr, kb, a, lda, b, ldb, c, ldc);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void sgemm_blocked(const size_t M, const size_t N, const size_t K,
+                   const float* A, const size_t lda,
+                   const float* B, const size_t ldb,
+                   float* C, const size_t ldc) {
+    if (M == 0 || N == 0 || K == 0)
+        return;
+
+    if (N >= 8) {
+        sgemm_tiles<4, 16>(M, N, K, A, lda, B, ldb, C, ldc);
+    } else {
+        // matrix-vector like products (small batch): more rows per tile to have independent accumulation chains
+        sgemm_tiles<8, 8>(M, N, K, A, lda, B, ldb, C, ldc);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
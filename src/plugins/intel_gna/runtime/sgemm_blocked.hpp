@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+/**
+ * @brief Row major C += A * B, where A is MxK, B is KxN and C is MxN.
+ * The result is split into register tiles which are computed in parallel, every element of C
+ * accumulates the products in the increasing order of k, so the result is bit exact with the naive loop.
+ * Rows of A may overlap (lda < K), which allows to run 1D convolution without im2col.
+ */
+void sgemm_blocked(const size_t M, const size_t N, const size_t K,
+                   const float* A, const size_t lda,
+                   const float* B, const size_t ldb,
+                   float* C, const size_t ldc);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -496,6 +496,73 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+TEST_P(CachingTest, TestCacheStatistics) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    using Statistics = std::map<std::string, uint64_t>;
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+            auto statistics = ie.GetMetric("", METRIC_KEY(CACHE_STATISTICS)).as<Statistics>();
+            EXPECT_EQ(0, statistics["hits"]);
+            EXPECT_EQ(1, statistics["misses"]);
+            EXPECT_GT(statistics["size_bytes"], 0);
+        });
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+            auto statistics = ie.GetMetric("", METRIC_KEY(CACHE_STATISTICS)).as<Statistics>();
+            EXPECT_EQ(1, statistics["hits"]);
+            EXPECT_EQ(0, statistics["misses"]);
+            EXPECT_EQ(0, statistics["evictions"]);
+        });
+    }
+}
+
+TEST_P(CachingTest, TestWrongCacheMaxSize) {
+    testLoad([&](Core &ie) {
+        for (const std::string value : {"-1", "", " 1", "10MB", "100000000000000000000000"}) {
+            EXPECT_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_MAX_SIZE), value}}), InferenceEngine::Exception) << value;
+        }
+        EXPECT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_MAX_SIZE), "1073741824"}}));
+    });
+}
+
+TEST_P(CachingTest, TestSharedCompiledModels) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+    // networks compiled for remote contexts are never shared
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 2 : 0);
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+    testLoad([&](Core &ie) {
+        ie.SetConfig({{CONFIG_KEY(SHARE_COMPILED_MODELS), CONFIG_VALUE(YES)}});
+        auto first = m_testFunction(ie);
+        auto second = m_testFunction(ie);
+        EXPECT_EQ(networks.size(), m_remoteContext ? 2 : 1);
+    });
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const char customData[] = {1, 2, 3, 4, 5};
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
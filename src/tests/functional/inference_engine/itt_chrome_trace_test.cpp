@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <regex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <common_test_utils/file_utils.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <openvino/itt.hpp>
+#include <openvino/pass/manager.hpp>
+#include <openvino/pass/constant_folding.hpp>
+
+namespace {
+OV_ITT_DOMAIN(ChromeTraceTest);
+}  // namespace
+
+// The test binary links its own copy of the itt library just like the plugins do,
+// so its tasks and the tasks of the runtime library must be written to one trace
+TEST(ChromeTraceTests, tasksOfAllLibrariesAreWrittenToOneTrace) {
+#ifndef ENABLE_PROFILING_ITT
+    GTEST_SKIP() << "OpenVINO is built without ENABLE_PROFILING_ITT";
+#else
+    const std::string path = "ChromeTraceTests.json";
+    const char* envPath = std::getenv("OPENVINO_TRACE_FILE");
+    ASSERT_TRUE(openvino::itt::startTrace(envPath ? envPath : path));
+
+    {
+        OV_ITT_SCOPED_TASK(ChromeTraceTest, "test_main_thread");
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::ConstantFolding>();
+        manager.run_passes(ngraph::builder::subgraph::makeConvPoolRelu());
+    }
+    std::thread([] {
+        OV_ITT_SCOPED_TASK(ChromeTraceTest, "test_worker_thread");
+    }).join();
+
+    ASSERT_TRUE(openvino::itt::dumpTrace(path));
+    std::ifstream file(path);
+    ASSERT_TRUE(file.is_open());
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);)
+        lines.push_back(line);
+    file.close();
+    CommonTestUtils::removeFile(path);
+
+    ASSERT_FALSE(lines.empty());
+    ASSERT_EQ(0u, lines.front().find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    ASSERT_EQ("]}", lines.back().substr(lines.back().size() - 2));
+
+    // one event per line
+    const std::regex eventRegex(
+        R"re(^(\{"displayTimeUnit":"ms","traceEvents":\[)?\{"name":"((?:[^"\\]|\\.)*)",)re"
+        R"re((?:"cat":"((?:[^"\\]|\\.)*)",)?"ph":"([XM])","pid":(\d+),"tid":(\d+),.*\}(,|\]\})$)re");
+    std::set<std::string> categories, pids;
+    std::string mainTid, workerTid;
+    for (size_t i = 0; i < lines.size(); i++) {
+        std::smatch match;
+        ASSERT_TRUE(std::regex_match(lines[i], match, eventRegex)) << lines[i];
+        ASSERT_EQ(i == 0, match[1].matched) << lines[i];
+        ASSERT_EQ(i + 1 == lines.size() ? "]}" : ",", match[7].str()) << lines[i];
+        pids.insert(match[5]);
+        if (match[4] != "X")
+            continue;
+        categories.insert(match[3]);
+        if (match[2] == "test_main_thread")
+            mainTid = match[6];
+        if (match[2] == "test_worker_thread")
+            workerTid = match[6];
+    }
+
+    EXPECT_EQ(1u, pids.size());
+    EXPECT_EQ(1u, categories.count("ChromeTraceTest"));
+    EXPECT_EQ(1u, categories.count("nGraph")) << "tasks of the runtime library are not recorded";
+    ASSERT_FALSE(mainTid.empty());
+    ASSERT_FALSE(workerTid.empty());
+    EXPECT_NE(mainTid, workerTid);
+#endif
+}
@@ -14,8 +14,20 @@ std::vector<size_t> batch_sizes = {
     16
 };
 
+// infer requests share the graph of the single stream, so every request must process its own batch
+std::vector<size_t> decreasing_batch_sizes = {
+    16,
+    9,
+    5,
+    1
+};
+
 std::map<std::string, std::string> additional_config = {
 };
+
+std::map<std::string, std::string> single_stream_config = {
+    {InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}
+};
 } // namespace
 
 
@@ -36,4 +48,13 @@ INSTANTIATE_TEST_SUITE_P(smoke_DynamicBatchTest_sync, DynamicBatchTest,
         ::testing::Values(false),
         ::testing::Values(additional_config)),
     DynamicBatchTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicBatchTest_shared_graph, DynamicBatchTest,
+    ::testing::Combine(
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(InferenceEngine::Precision::FP32),
+        ::testing::Values(decreasing_batch_sizes),
+        ::testing::Values(false),
+        ::testing::Values(single_stream_config)),
+    DynamicBatchTest::getTestCaseName);
 } // namespace ConfigurationTestsDefinitions
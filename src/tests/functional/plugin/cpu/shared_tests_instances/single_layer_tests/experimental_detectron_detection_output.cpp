@@ -66,4 +66,24 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExperimentalDetectronDetectionOutput, Experimenta
                  ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          ExperimentalDetectronDetectionOutputLayerTest::getTestCaseName);
 
+// several classes with enough boxes to keep more than one block of detections per class
+const std::vector<std::vector<InputShape>> inputShapesMultiClass = {
+        static_shapes_to_test_representation({{128, 4}, {128, 32}, {128, 8}, {1, 3}})
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExperimentalDetectronDetectionOutput_MultiClass, ExperimentalDetectronDetectionOutputLayerTest,
+         ::testing::Combine(
+                 ::testing::ValuesIn(inputShapesMultiClass),
+                 ::testing::ValuesIn(score_threshold),
+                 ::testing::Values(0.7f),
+                 ::testing::ValuesIn(max_delta_log_wh),
+                 ::testing::Values(int64_t{8}),
+                 ::testing::Values(int64_t{40}),
+                 ::testing::Values(size_t{100}),
+                 ::testing::ValuesIn(class_agnostic_box_regression),
+                 ::testing::ValuesIn(deltas_weights),
+                 ::testing::Values(ov::element::Type_t::f32),
+                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         ExperimentalDetectronDetectionOutputLayerTest::getTestCaseName);
+
 } // namespace
@@ -205,4 +205,35 @@ const auto gather7ParamsSubset_NegativeBD = testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_Gather7_NegativeBD, Gather7LayerTest, gather7ParamsSubset_NegativeBD, Gather7LayerTest::getTestCaseName);
 
+const std::vector<std::vector<size_t>> inputShapes_8 = {
+        std::vector<size_t>{2, 3, 1000},
+        std::vector<size_t>{2, 3, 7, 5},
+};
+
+const std::vector<std::vector<size_t>> indicesShapes_8 = {
+        std::vector<size_t>{2, 64},
+        std::vector<size_t>{2, 3},
+};
+
+// Gather-8 is executed natively, indices cover negative values
+const std::vector<std::tuple<int, int>> axes_batchdims_8 = {
+        std::tuple<int, int>{-1, 0},
+        std::tuple<int, int>{2, 1},
+        std::tuple<int, int>{1, 0},
+};
+
+const auto gather8Params = testing::Combine(
+        testing::ValuesIn(inputShapes_8),
+        testing::ValuesIn(indicesShapes_8),
+        testing::ValuesIn(axes_batchdims_8),
+        testing::ValuesIn(netPrecisions),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(InferenceEngine::Layout::ANY),
+        testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather8, Gather8LayerTest, gather8Params, Gather8LayerTest::getTestCaseName);
+
 }  // namespace
@@ -157,7 +157,8 @@ protected:
 
         function = makeNgraphFunction(netPrecision, params, lstmSequenceOp, "lstmSequenceOp");
 
-        if (seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ) {
+        if (seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ &&
+                seqMode != ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST) {
             ov::pass::Manager manager;
             if (direction == ngraph::op::RecurrentSequenceDirection::BIDIRECTIONAL)
                 manager.register_pass<ngraph::pass::BidirectionalLSTMSequenceDecomposition>();
@@ -268,6 +269,27 @@ INSTANTIATE_TEST_SUITE_P(nightly_static_bf16, LSTMSequenceCPUTest,
                                    ::testing::Values(additionalConfig[1])),
                 LSTMSequenceCPUTest::getTestCaseName);
 
+// Samples of different lengths (including zero) and clipping in the saturation range of the activations
+// are computed by the sequence primitive without TensorIterator.
+const std::vector<InputShape> seqLengthsShapes = {
+    { {}, { {10, 5, 10} } },
+    { {}, { {10, 1, 10} } },
+    { {}, { {10, 1, 10} } },
+    { {}, { {10} } }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_SeqLengths, LSTMSequenceCPUTest,
+                ::testing::Combine(::testing::Values(seqLengthsShapes),
+                                   ::testing::Values(ngraph::helpers::SequenceTestsMode::PURE_SEQ_RAND_SEQ_LEN_CONST),
+                                   ::testing::ValuesIn(activations),
+                                   ::testing::Values(0.f, 25.f),
+                                   ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                     ov::op::RecurrentSequenceDirection::REVERSE),
+                                   ::testing::ValuesIn(netPrecisions),
+                                   ::testing::Values(cpuParams),
+                                   ::testing::Values(std::map<std::string, std::string>{})),
+                LSTMSequenceCPUTest::getTestCaseName);
+
 const std::vector<std::vector<InputShape>> dynamicShapes = {
     { { {-1, {1, 5}, 10},                           // #0. Dynamic shape 0
         { {10, 2, 10}, {8, 3, 10}, {5, 4, 10} } },  // Target shapes
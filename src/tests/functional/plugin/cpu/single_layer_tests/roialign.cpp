@@ -207,6 +207,7 @@ const std::vector<ROIAlignShapes> inputShapeVector = {
     ROIAlignShapes{{{}, {{ 2, 4, 20, 20 }}}, {{}, {{1, 4}}}, {{}, {{1}}}},
     ROIAlignShapes{{{}, {{ 2, 4, 20, 40 }}}, {{}, {{1, 4}}}, {{}, {{1}}}},
     ROIAlignShapes{{{}, {{ 10, 1, 20, 20 }}}, {{}, {{1, 4}}}, {{}, {{1}}}},
+    ROIAlignShapes{{{}, {{ 2, 40, 20, 20 }}}, {{}, {{12, 4}}}, {{}, {{12}}}},
     ROIAlignShapes{
         {{-1, -1, -1, -1}, {{ 10, 1, 20, 20 }, { 2, 4, 20, 20 }, { 2, 18, 20, 20 }}},
         {{-1, 4}, {{1, 4}, {2, 4}, {1, 4}}},
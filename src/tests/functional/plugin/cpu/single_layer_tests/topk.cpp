@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+
 #include "functional_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/data_utils.hpp"
 #include "test_utils/cpu_test_utils.hpp"
@@ -112,6 +114,8 @@ TEST_P(TopKLayerCPUTest, CompareWithRefs) {
 
 const ngraph::element::TypeVector inputPrecisions = {
     ngraph::element::f32,
+    ngraph::element::bf16,
+    ngraph::element::i32,
 };
 
 const std::vector<int64_t> axes = { 0, 1, 2 };
@@ -169,4 +173,153 @@ const auto testCases = ::testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, TopKLayerCPUTest, testCases, TopKLayerCPUTest::getTestCaseName);
 
+// few long slices, the axis is split between threads
+const std::vector<InputShape> inShapesLargeAxis = {
+    InputShape{
+        // dynamic
+        {-1, -1, -1},
+        // target
+        {
+            {1, 50000, 1},
+            {2, 16384, 3}
+        }
+    },
+};
+
+const auto testCasesLargeAxis = ::testing::Combine(
+    ::testing::Values(ngraph::element::f32, ngraph::element::i32),
+    ::testing::ValuesIn(inShapesLargeAxis),
+    ::testing::Values(1),
+    ::testing::ValuesIn(modes),
+    ::testing::ValuesIn(sortTypes)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_LargeAxis, TopKLayerCPUTest, testCasesLargeAxis, TopKLayerCPUTest::getTestCaseName);
+
+// NaN is greater than any value: it goes first for max and last for min, equal values are ordered by index.
+// The reference implementation doesn't define the order of NaN, so expected outputs are computed here.
+class TopKNaNLayerCPUTest : public TopKLayerCPUTest {
+protected:
+    void generate_inputs(const std::vector<ngraph::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        const float pattern[] = {1.f, NAN, INFINITY, -2.f, -INFINITY, 1.f, NAN, 0.f, INFINITY, 3.f, -INFINITY};
+        const size_t patternSize = sizeof(pattern) / sizeof(pattern[0]);
+
+        ov::runtime::Tensor dataTensor{funcInputs[0].get_element_type(), targetInputStaticShapes[0]};
+        for (size_t i = 0; i < dataTensor.get_size(); i++) {
+            const float value = pattern[(i * 7 + i / patternSize) % patternSize];
+            if (dataTensor.get_element_type() == ngraph::element::bf16)
+                dataTensor.data<ov::bfloat16>()[i] = ov::bfloat16(value);
+            else
+                dataTensor.data<float>()[i] = value;
+        }
+        ov::runtime::Tensor kTensor{funcInputs[1].get_element_type(), targetInputStaticShapes[1]};
+        kTensor.data<int32_t>()[0] = 5;
+
+        inputs.insert({ funcInputs[0].get_node_shared_ptr(), dataTensor });
+        inputs.insert({ funcInputs[1].get_node_shared_ptr(), kTensor });
+    }
+
+    std::vector<ov::runtime::Tensor> calculate_refs() override {
+        const auto& funcInputs = function->inputs();
+        const auto& data = inputs.at(funcInputs[0].get_node_shared_ptr());
+        const int32_t k = inputs.at(funcInputs[1].get_node_shared_ptr()).data<int32_t>()[0];
+        const auto axis = std::get<2>(GetParam());
+        const bool modeMax = std::get<3>(GetParam()) == ngraph::opset4::TopK::Mode::MAX;
+        const bool sortValues = std::get<4>(GetParam()) == ngraph::opset4::TopK::SortType::SORT_VALUES;
+
+        const auto& shape = data.get_shape();
+        const size_t dim = shape[axis];
+        const size_t after = ngraph::shape_size(ngraph::Shape(shape.begin() + axis + 1, shape.end()));
+        const size_t before = data.get_size() / dim / after;
+        auto outShape = shape;
+        outShape[axis] = k;
+        ov::runtime::Tensor values{data.get_element_type(), outShape};
+        ov::runtime::Tensor indices{ngraph::element::i32, outShape};
+
+        auto load = [&](size_t i) {
+            return data.get_element_type() == ngraph::element::bf16 ? static_cast<float>(data.data<ov::bfloat16>()[i])
+                                                                      : data.data<float>()[i];
+        };
+        auto better = [&](const std::pair<float, int32_t>& a, const std::pair<float, int32_t>& b) {
+            if (std::isnan(a.first) != std::isnan(b.first))
+                return modeMax ? std::isnan(a.first) : std::isnan(b.first);
+            if (!std::isnan(a.first) && a.first != b.first)
+                return modeMax ? a.first > b.first : a.first < b.first;
+            return a.second < b.second;
+        };
+        std::vector<std::pair<float, int32_t>> items(dim);
+        for (size_t b = 0; b < before; b++) {
+            for (size_t a = 0; a < after; a++) {
+                for (size_t i = 0; i < dim; i++)
+                    items[i] = {load((b * dim + i) * after + a), static_cast<int32_t>(i)};
+                std::sort(items.begin(), items.end(), better);
+                if (!sortValues) {
+                    std::sort(items.begin(), items.begin() + k, [](const std::pair<float, int32_t>& x, const std::pair<float, int32_t>& y) {
+                        return x.second < y.second;
+                    });
+                }
+                for (int32_t i = 0; i < k; i++) {
+                    const size_t offset = (b * k + i) * after + a;
+                    if (values.get_element_type() == ngraph::element::bf16)
+                        values.data<ov::bfloat16>()[offset] = ov::bfloat16(items[i].first);
+                    else
+                        values.data<float>()[offset] = items[i].first;
+                    indices.data<int32_t>()[offset] = items[i].second;
+                }
+            }
+        }
+        return {values, indices};
+    }
+
+    void compare(const std::vector<ov::runtime::Tensor>& expected, const std::vector<ov::runtime::Tensor>& actual) override {
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_EQ(expected[1].get_size(), actual[1].get_size());
+        for (size_t i = 0; i < expected[1].get_size(); i++) {
+            ASSERT_EQ(expected[1].data<int32_t>()[i], actual[1].data<int32_t>()[i]) << "index mismatch at " << i;
+            const bool bf16 = expected[0].get_element_type() == ngraph::element::bf16;
+            const float expectedValue = bf16 ? static_cast<float>(expected[0].data<ov::bfloat16>()[i]) : expected[0].data<float>()[i];
+            const float actualValue = bf16 ? static_cast<float>(actual[0].data<ov::bfloat16>()[i]) : actual[0].data<float>()[i];
+            if (std::isnan(expectedValue))
+                ASSERT_TRUE(std::isnan(actualValue)) << "value mismatch at " << i;
+            else
+                ASSERT_EQ(expectedValue, actualValue) << "value mismatch at " << i;
+        }
+    }
+};
+
+TEST_P(TopKNaNLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckPluginRelatedResults(executableNetwork, "TopK");
+}
+
+// k > 1 along the last axis and long axes are processed by the selection for f32, bf16 always uses it
+const std::vector<InputShape> inShapesNaN = {
+    InputShape{{}, {{2, 3, 37}}},
+};
+
+const auto testCasesNaN = ::testing::Combine(
+    ::testing::Values(ngraph::element::f32, ngraph::element::bf16),
+    ::testing::ValuesIn(inShapesNaN),
+    ::testing::Values(2),
+    ::testing::ValuesIn(modes),
+    ::testing::ValuesIn(sortTypes)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_NaN, TopKNaNLayerCPUTest, testCasesNaN, TopKLayerCPUTest::getTestCaseName);
+
+// the only slice is split between threads
+const auto testCasesNaNLargeAxis = ::testing::Combine(
+    ::testing::Values(ngraph::element::f32),
+    ::testing::Values(InputShape{{}, {{1, 50000, 1}}}),
+    ::testing::Values(1),
+    ::testing::ValuesIn(modes),
+    ::testing::ValuesIn(sortTypes)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs_NaN_LargeAxis, TopKNaNLayerCPUTest, testCasesNaNLargeAxis, TopKLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class ConvNonConstWeights : virtual public LayerTestsUtils::LayerTestsCommon,
+                            public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // planar data and output, so any Reorder in the graph could only be the one of the weights
+        inFmts = {nchw};
+        outFmts = {nchw};
+
+        std::vector<size_t> dataShape {1, 8, 16, 16};
+        std::vector<size_t> weightsShape {16, 8, 3, 3};
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {dataShape, weightsShape});
+        auto conv = std::make_shared<ngraph::opset1::Convolution>(params[0], params[1],
+                                                                  ngraph::Strides{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::CoordinateDiff{1, 1},
+                                                                  ngraph::Strides{1, 1});
+
+        function = makeNgraphFunction(ngraph::element::f32, params, conv, "ConvNonConstWeights");
+    }
+};
+
+/* Convolution with weights computed by the model.
+ * Test that the weights are passed to the Convolution node in the plain layout
+ * and reordered by the node itself instead of a separate Reorder executed on every inference.
+
+    Input[FP32]   Input[FP32]
+        |              |
+        |              X  No Reorder
+        |              |
+       Convolution[FP32]
+        |
+    Output[FP32]
+*/
+TEST_F(ConvNonConstWeights, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "Convolution", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Reference", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Reorder", 0);
+}
+
+/* The weights reordered on an inference are reused by the next one only if the weights don't change.
+ * Test that new values written to the same weights blob are reordered again.
+ */
+TEST_F(ConvNonConstWeights, ChangedWeightsInSameBlob) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto weights = InferenceEngine::as<InferenceEngine::MemoryBlob>(inputs[1]);
+    ASSERT_NE(weights, nullptr);
+    {
+        auto weightsMap = weights->wmap();
+        auto weightsData = weightsMap.as<float*>();
+        for (size_t i = 0; i < weights->size(); i++)
+            weightsData[i] = -0.5f * weightsData[i] + 0.25f;
+    }
+    inferRequest.Infer();
+    Validate();
+
+    CheckNodeOfTypeCount(executableNetwork, "Reorder", 0);
+}
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <cpu/cpu_config.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class ConvertReorderFusion : virtual public LayerTestsUtils::LayerTestsCommon,
+                             public CPUTestsBase {
+protected:
+    void SetUp() override {
+        inPrc = Precision::U8;
+        outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape {1, 16, 16, 16};
+
+        auto input = ngraph::builder::makeParams(ngraph::element::u8, {inputShape});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input[0], ngraph::element::f32);
+        auto conv = ngraph::builder::makeConvolution(convert, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16);
+
+        function = makeNgraphFunction(ngraph::element::f32, input, conv, "ConvertReorderFusion");
+    }
+};
+
+/* U8 planar input of a convolution working with the blocked layout.
+ * Test that the precision conversion and the layout change are done by a single Reorder,
+ * so the input is read only once.
+
+    Input[U8, nchw]
+        |
+    Reorder[U8 nchw -> FP32 blocked]
+        |
+        X  No Convert
+        |
+    Convolution[FP32]
+        |
+    Output[FP32]
+*/
+TEST_F(ConvertReorderFusion, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    ASSERT_GE(executableNetwork.GetMetric(CPU_METRIC_KEY(ELIMINATED_DATA_PASSES)).as<unsigned int>(), 1);
+}
+} // namespace CPULayerTestsDefinitions
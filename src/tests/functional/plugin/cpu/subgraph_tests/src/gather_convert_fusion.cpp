@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class GatherConvertFusion : virtual public LayerTestsUtils::LayerTestsCommon,
+                            public CPUTestsBase {
+protected:
+    void SetUp() override {
+        inPrc = Precision::I32;
+        outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> tableShape {16, 8};
+        std::vector<size_t> indicesShape {1, 20};
+
+        auto indices = ngraph::builder::makeParams(ngraph::element::i32, {indicesShape});
+        auto table = ngraph::builder::makeConstant<int8_t>(ngraph::element::i8, tableShape, {}, true, 100, -100);
+        auto convert = std::make_shared<ngraph::opset1::Convert>(table, ngraph::element::f32);
+        auto axis = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto gather = std::make_shared<ngraph::opset8::Gather>(convert, indices[0], axis);
+
+        function = makeNgraphFunction(ngraph::element::f32, indices, gather, "GatherConvertFusion");
+    }
+};
+
+/* Embedding lookup in a compressed table.
+ * Test that the table is not folded to FP32 and the Convert is fused into Gather,
+ * which dequantizes only the gathered rows.
+
+    Constant[I8]   Input[I32]
+        |              |
+        X  No Convert  |
+        |              |
+       Gather[I8->FP32]
+        |
+    Output[FP32]
+*/
+TEST_F(GatherConvertFusion, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Gather", 1);
+}
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class InputConvertEltwise : virtual public LayerTestsUtils::LayerTestsCommon,
+                            public CPUTestsBase {
+protected:
+    void SetUp() override {
+        inPrc = Precision::U8;
+        outPrc = Precision::FP32;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape {1, 3, 16, 16};
+        std::vector<size_t> constShape {1, 3, 1, 1};
+
+        auto input = ngraph::builder::makeParams(ngraph::element::u8, {inputShape});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input[0], ngraph::element::f32);
+        auto mean = ngraph::builder::makeConstant<float>(ngraph::element::f32, constShape, {123.675f, 116.28f, 103.53f});
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, constShape, {0.0171f, 0.0175f, 0.0174f});
+        auto subtract = ngraph::builder::makeEltwise(convert, mean, ngraph::helpers::EltwiseTypes::SUBTRACT);
+        auto multiply = ngraph::builder::makeEltwise(subtract, scale, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+        function = makeNgraphFunction(ngraph::element::f32, input, multiply, "InputConvertEltwise");
+    }
+};
+
+/* Preprocessing chain on U8 input.
+ * Test that Convert is fused into the Eltwise chain, so the input is read only once.
+
+    Input[U8]
+        |
+        X  No Convert
+        |
+    Eltwise[U8->FP32] (Subtract + Multiply)
+        |
+    Output[FP32]
+*/
+TEST_F(InputConvertEltwise, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Eltwise", 1);
+}
+} // namespace CPULayerTestsDefinitions
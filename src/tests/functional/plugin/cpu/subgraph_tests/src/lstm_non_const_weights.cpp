@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include "ie_common.h"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class LSTMSequenceNonConstWeights : virtual public LayerTestsUtils::LayerTestsCommon,
+                                    public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t batch = 2, seqLength = 3, inputSize = 8, hiddenSize = 16;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{batch, seqLength, inputSize},
+                                                                         {batch, 1, hiddenSize},
+                                                                         {batch, 1, hiddenSize},
+                                                                         {1, 4 * hiddenSize, inputSize},
+                                                                         {1, 4 * hiddenSize, hiddenSize},
+                                                                         {1, 4 * hiddenSize}});
+        auto seqLengths = ngraph::builder::makeConstant(ngraph::element::i64, {batch}, std::vector<int64_t>{3, 1});
+        auto lstm = std::make_shared<ngraph::opset5::LSTMSequence>(params[0], params[1], params[2], seqLengths,
+                                                                   params[3], params[4], params[5], hiddenSize,
+                                                                   ngraph::op::RecurrentSequenceDirection::FORWARD);
+
+        function = makeNgraphFunction(ngraph::element::f32, params, lstm, "LSTMSequenceNonConstWeights");
+    }
+};
+
+/* LSTMSequence with weights computed by the model and samples of different lengths.
+ * Test that the sequence is executed by the RNN primitive instead of a TensorIterator
+ * with a decomposed cell.
+
+    Input  Input  Input  Input[W]  Input[R]  Input[B]
+      |      |      |       |         |         |
+     LSTMSequence[FP32] <-- Constant[sequence lengths]
+      |      |      |
+    Output Output Output
+*/
+TEST_F(LSTMSequenceNonConstWeights, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "RNNSeq", 1);
+    CheckNodeOfTypeCount(executableNetwork, "TensorIterator", 0);
+}
+
+/* The weights are repacked into the layout of the primitive only when they change.
+ * Test an inference with the same weights (no repack) and then with new W, R and B
+ * written to the same blobs (repack).
+ */
+TEST_F(LSTMSequenceNonConstWeights, ChangedWeightsInSameBlobs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    inferRequest.Infer();
+    Validate();
+
+    for (size_t i = 3; i < inputs.size(); i++) {
+        auto weights = InferenceEngine::as<InferenceEngine::MemoryBlob>(inputs[i]);
+        ASSERT_NE(weights, nullptr);
+        auto weightsMap = weights->wmap();
+        auto weightsData = weightsMap.as<float*>();
+        for (size_t j = 0; j < weights->size(); j++)
+            weightsData[j] = -0.5f * weightsData[j] + 0.1f;
+    }
+    inferRequest.Infer();
+    Validate();
+}
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using ScaledDotProductAttentionParams = std::tuple<bool,     // keys are transposed before MatMul
+                                                   bool>;    // with additive mask
+
+class ScaledDotProductAttentionTest : public testing::WithParamInterface<ScaledDotProductAttentionParams>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ScaledDotProductAttentionParams> obj) {
+        bool keysTransposed, withMask;
+        std::tie(keysTransposed, withMask) = obj.param;
+
+        std::ostringstream result;
+        result << "KeysTransposed=" << keysTransposed << "_";
+        result << "WithMask=" << withMask;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        bool keysTransposed, withMask;
+        std::tie(keysTransposed, withMask) = this->GetParam();
+
+        // two blocks of queries and two blocks of keys
+        const size_t heads = 4, queriesLen = 40, keysLen = 300, headSize = 16;
+        const Shape queriesShape{1, heads, queriesLen, headSize};
+        const Shape keysShape = keysTransposed ? Shape{1, heads, headSize, keysLen} : Shape{1, heads, keysLen, headSize};
+        const Shape valuesShape{1, heads, keysLen, headSize};
+        const Shape maskShape{1, 1, 1, keysLen};
+
+        auto params = builder::makeParams(element::f32, {queriesShape, keysShape, valuesShape});
+        if (withMask)
+            params.push_back(builder::makeParams(element::f32, {maskShape})[0]);
+
+        auto qk = std::make_shared<opset1::MatMul>(params[0], params[1], false, !keysTransposed);
+        std::shared_ptr<Node> scores;
+        if (keysTransposed) {
+            scores = std::make_shared<opset1::Divide>(qk, opset1::Constant::create(element::f32, Shape{}, {8.f}));
+        } else {
+            scores = std::make_shared<opset1::Multiply>(qk, opset1::Constant::create(element::f32, Shape{1}, {0.125f}));
+        }
+        if (withMask)
+            scores = std::make_shared<opset1::Add>(params[3], scores);
+        auto softmax = std::make_shared<opset1::Softmax>(scores, 3);
+        auto attention = std::make_shared<opset1::MatMul>(softmax, params[2]);
+
+        function = std::make_shared<ngraph::Function>(std::make_shared<opset1::Result>(attention), params, "ScaledDotProductAttention");
+    }
+};
+
+/* MatMul(Q, K) -> Multiply/Divide(scale) -> [Add(mask)] -> Softmax -> MatMul(V)
+ * is executed by a single ScaledDotProductAttention node
+ */
+TEST_P(ScaledDotProductAttentionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNodeOfTypeCount(executableNetwork, "ScaledDotProductAttention", 1);
+    CheckNodeOfTypeCount(executableNetwork, "MatMul", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScaledDotProductAttention, ScaledDotProductAttentionTest,
+                         ::testing::Combine(::testing::Bool(), ::testing::Bool()),
+                         ScaledDotProductAttentionTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -10,7 +10,8 @@ namespace {
 OPENVINO_SUPPRESS_DEPRECATED_START
 
 const std::vector<std::map<std::string, std::string>> configs = {
-        {{GNA_CONFIG_KEY(LIB_N_THREADS), "3"}}
+        {{GNA_CONFIG_KEY(LIB_N_THREADS), "3"}},
+        {{GNA_CONFIG_KEY(DEVICE_MODE), GNA_CONFIG_VALUE(SW_FP32)}, {GNA_CONFIG_KEY(LIB_N_THREADS), "3"}}
 };
 
 OPENVINO_SUPPRESS_DEPRECATED_END
@@ -0,0 +1,120 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_allocator.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+bool isAligned(const std::shared_ptr<void>& ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr.get()) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(MemoryAllocatorTest, Statistics) {
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::Default, false, -1);
+    ASSERT_EQ(allocator->getType(), MKLDNNMemoryAllocator::Type::Default);
+    const auto& statistics = allocator->getStatistics();
+    {
+        auto weights = allocator->allocate(1000, MemoryCategory::Weights);
+        auto activations = allocator->allocate(100, MemoryCategory::Activations);
+        ASSERT_TRUE(isAligned(weights, MKLDNNMemoryAllocator::alignment));
+        ASSERT_TRUE(isAligned(activations, MKLDNNMemoryAllocator::alignment));
+
+        ASSERT_GE(statistics.allocated(MemoryCategory::Weights), 1000u);
+        ASSERT_GE(statistics.allocated(MemoryCategory::Activations), 100u);
+        ASSERT_EQ(statistics.allocated(MemoryCategory::Scratchpad), 0u);
+        ASSERT_EQ(statistics.allocations(MemoryCategory::Weights), 1u);
+    }
+    ASSERT_EQ(statistics.allocated(MemoryCategory::Weights), 0u);
+    ASSERT_EQ(statistics.allocated(MemoryCategory::Activations), 0u);
+    ASSERT_GE(statistics.peak(MemoryCategory::Weights), 1000u);
+    ASSERT_EQ(allocator->getPooledSize(), 0u);
+}
+
+TEST(MemoryAllocatorTest, Pool) {
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::Default, true, -1);
+    void* released = nullptr;
+    {
+        auto data = allocator->allocate(10000, MemoryCategory::Activations);
+        released = data.get();
+    }
+    ASSERT_GE(allocator->getPooledSize(), 10000u);
+
+    // an allocation of a bit different size fits into the same block
+    auto data = allocator->allocate(9000, MemoryCategory::Activations);
+    ASSERT_EQ(data.get(), released);
+    ASSERT_EQ(allocator->getPooledSize(), 0u);
+    ASSERT_EQ(allocator->getStatistics().allocations(MemoryCategory::Activations), 2u);
+}
+
+TEST(MemoryAllocatorTest, PoolReusesLargerBlock) {
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::Default, true, -1);
+    void* released = nullptr;
+    {
+        auto data = allocator->allocate(100000, MemoryCategory::Activations);
+        released = data.get();
+    }
+    const size_t block = allocator->getPooledSize();
+
+    // the block of a bigger shape is taken as a whole and returned to the pool as a whole
+    {
+        auto data = allocator->allocate(60000, MemoryCategory::Activations);
+        ASSERT_EQ(data.get(), released);
+        ASSERT_EQ(allocator->getStatistics().allocated(MemoryCategory::Activations), block);
+    }
+    ASSERT_EQ(allocator->getPooledSize(), block);
+
+    // most of the block would be wasted by a much smaller allocation
+    auto data = allocator->allocate(10000, MemoryCategory::Activations);
+    ASSERT_NE(data.get(), released);
+    ASSERT_EQ(allocator->getPooledSize(), block);
+}
+
+TEST(MemoryAllocatorTest, PoolLimit) {
+    const size_t poolLimit = 64 * 1024;
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::Default, true, -1, nullptr, poolLimit);
+
+    // every iteration has a new shape, the pool keeps only the blocks which fit into the limit
+    for (size_t size = 4 * 1024; size <= 1024 * 1024; size *= 2) {
+        auto data = allocator->allocate(size, MemoryCategory::Activations);
+        ASSERT_LE(allocator->getPooledSize(), poolLimit);
+    }
+    ASSERT_LE(allocator->getPooledSize(), poolLimit);
+    ASSERT_GT(allocator->getPooledSize(), 0u);
+    ASSERT_EQ(allocator->getStatistics().allocated(MemoryCategory::Activations), 0u);
+}
+
+TEST(MemoryAllocatorTest, HugePages) {
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::HugePages, false, 0);
+    const size_t size = 3 * 1024 * 1024;
+    auto data = allocator->allocate(size, MemoryCategory::Weights);
+    ASSERT_TRUE(isAligned(data, MKLDNNMemoryAllocator::alignment));
+    std::memset(data.get(), 1, size);
+    ASSERT_GE(allocator->getStatistics().allocated(MemoryCategory::Weights), size);
+
+    auto small = allocator->allocate(100, MemoryCategory::Scratchpad);
+    ASSERT_TRUE(isAligned(small, MKLDNNMemoryAllocator::alignment));
+}
+
+TEST(MemoryAllocatorTest, Scope) {
+    auto allocator = MKLDNNMemoryAllocator::create(MKLDNNMemoryAllocator::Type::Default, false, -1);
+    ASSERT_EQ(MKLDNNMemoryAllocationScope::currentAllocator(), nullptr);
+    {
+        MKLDNNMemoryAllocationScope graphScope(allocator, MemoryCategory::Scratchpad);
+        {
+            MKLDNNMemoryAllocationScope weightsScope(MemoryCategory::Weights);
+            ASSERT_EQ(MKLDNNMemoryAllocationScope::currentAllocator(), allocator);
+            ASSERT_EQ(MKLDNNMemoryAllocationScope::currentCategory(), MemoryCategory::Weights);
+        }
+        ASSERT_EQ(MKLDNNMemoryAllocationScope::currentCategory(), MemoryCategory::Scratchpad);
+    }
+    ASSERT_EQ(MKLDNNMemoryAllocationScope::currentAllocator(), nullptr);
+}
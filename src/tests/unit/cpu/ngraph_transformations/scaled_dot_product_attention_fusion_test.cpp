@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/scaled_dot_product_attention_fusion.hpp>
+#include <ngraph_transformations/op/scaled_dot_product_attention.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// MatMul(Q, K) -> Multiply(scale) -> [Add(mask)] -> Softmax -> MatMul(V)
+std::shared_ptr<ngraph::Function> makeAttentionFunction(const ngraph::PartialShape& queriesShape,
+                                                        const ngraph::PartialShape& keysShape,
+                                                        const ngraph::PartialShape& valuesShape,
+                                                        const ngraph::PartialShape& maskShape = ngraph::PartialShape::dynamic()) {
+    auto queries = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, queriesShape);
+    auto keys = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, keysShape);
+    auto values = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, valuesShape);
+    ngraph::ParameterVector params{queries, keys, values};
+
+    auto qk = std::make_shared<ngraph::opset1::MatMul>(queries, keys, false, true);
+    std::shared_ptr<ngraph::Node> scores =
+        std::make_shared<ngraph::opset1::Multiply>(qk, ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.125f}));
+    if (maskShape.rank().is_static()) {
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, maskShape);
+        params.push_back(mask);
+        scores = std::make_shared<ngraph::opset1::Add>(scores, mask);
+    }
+    auto softmax = std::make_shared<ngraph::opset1::Softmax>(scores, 3);
+    auto attention = std::make_shared<ngraph::opset1::MatMul>(softmax, values);
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, params);
+}
+
+template <typename T>
+size_t countAttentionOps(const std::shared_ptr<ngraph::Function>& f) {
+    size_t count = 0;
+    for (const auto& op : f->get_ops()) {
+        if (ngraph::is_type<T>(op))
+            count++;
+    }
+    return count;
+}
+
+void runAttentionFusion(const std::shared_ptr<ngraph::Function>& f) {
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::pass::InitNodeInfo>();
+    m.register_pass<ScaledDotProductAttentionFusion>();
+    m.run_passes(f);
+}
+
+}  // namespace
+
+TEST(TransformationTests, ScaledDotProductAttentionFusionWithMask) {
+    auto f = makeAttentionFunction({2, 4, 40, 16}, {2, 4, 300, 16}, {2, 4, 300, 16}, {2, 1, 1, 300});
+    runAttentionFusion(f);
+
+    std::shared_ptr<ngraph::Function> f_ref(nullptr);
+    {
+        auto queries = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 40, 16});
+        auto keys = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 300, 16});
+        auto values = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 300, 16});
+        auto mask = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 1, 1, 300});
+        auto attention = std::make_shared<ScaledDotProductAttentionNode>(queries, keys, values, mask, 0.125f, false);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{attention}, ngraph::ParameterVector{queries, keys, values, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+// batch dimensions which can't be 1 are equal at runtime, otherwise MatMul would fail
+TEST(TransformationTests, ScaledDotProductAttentionFusionBoundedBatch) {
+    const ngraph::Dimension batch(2, 8);
+    auto f = makeAttentionFunction({batch, 4, 40, 16}, {batch, 4, 300, 16}, {batch, 4, 300, 16});
+    runAttentionFusion(f);
+
+    ASSERT_EQ(1u, countAttentionOps<ScaledDotProductAttentionNode>(f));
+    ASSERT_EQ(0u, countAttentionOps<ngraph::opset1::MatMul>(f));
+}
+
+// keys and values are broadcasted to the dynamic batch of queries, the fused node doesn't support that
+TEST(TransformationTests, ScaledDotProductAttentionFusionBroadcastedKeysNegative) {
+    const ngraph::PartialShape queriesShape{ngraph::Dimension::dynamic(), 4, 40, 16};
+    auto f = makeAttentionFunction(queriesShape, {1, 4, 300, 16}, {1, 4, 300, 16});
+    runAttentionFusion(f);
+    auto f_ref = makeAttentionFunction(queriesShape, {1, 4, 300, 16}, {1, 4, 300, 16});
+
+    ASSERT_EQ(0u, countAttentionOps<ScaledDotProductAttentionNode>(f));
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+// the mask broadcasts the scores to a bigger batch, so the output of Add differs from the scores shape
+TEST(TransformationTests, ScaledDotProductAttentionFusionBroadcastingMaskNegative) {
+    auto f = makeAttentionFunction({1, 4, 40, 16}, {1, 4, 300, 16}, {1, 4, 300, 16}, {3, 1, 1, 300});
+    runAttentionFusion(f);
+    auto f_ref = makeAttentionFunction({1, 4, 40, 16}, {1, 4, 300, 16}, {1, 4, 300, 16}, {3, 1, 1, 300});
+
+    ASSERT_EQ(0u, countAttentionOps<ScaledDotProductAttentionNode>(f));
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+// the dynamic mask dimension may broadcast the scores at runtime
+TEST(TransformationTests, ScaledDotProductAttentionFusionDynamicMaskNegative) {
+    const ngraph::PartialShape maskShape{ngraph::Dimension::dynamic(), 1, 1, 300};
+    auto f = makeAttentionFunction({1, 4, 40, 16}, {1, 4, 300, 16}, {1, 4, 300, 16}, maskShape);
+    runAttentionFusion(f);
+    auto f_ref = makeAttentionFunction({1, 4, 40, 16}, {1, 4, 300, 16}, {1, 4, 300, 16}, maskShape);
+
+    ASSERT_EQ(0u, countAttentionOps<ScaledDotProductAttentionNode>(f));
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
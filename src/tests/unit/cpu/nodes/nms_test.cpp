@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/nms.h"
+
+using namespace MKLDNNPlugin::nms;
+
+namespace {
+
+Box makeBox(float x0, float y0, float x1, float y1, float offset) {
+    return {x0, y0, x1, y1, boxArea(x0, y0, x1, y1, offset)};
+}
+
+float computeIoU(const Box& a, const Box& b, const IoUParams& params) {
+    BoxSet boxes;
+    boxes.push_back(b);
+    float iou = -1.f;
+    intersectionOverUnion(a, boxes, 0, 1, params, &iou);
+    return iou;
+}
+
+BoxSet makeRandomBoxes(size_t num, float offset, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> position(0.f, 100.f);
+    std::uniform_real_distribution<float> extent(1.f, 20.f);
+    BoxSet boxes(num);
+    for (size_t i = 0; i < num; i++) {
+        const float x0 = position(gen), y0 = position(gen);
+        boxes.push_back(makeBox(x0, y0, x0 + extent(gen), y0 + extent(gen), offset));
+    }
+    return boxes;
+}
+
+std::vector<int> suppress(const BoxSet& boxes, size_t maxOut, const SuppressParams& params, bool parallel) {
+    std::vector<int> kept(boxes.size());
+    const size_t count = parallel ? suppressSortedParallel(boxes, maxOut, params, kept.data())
+                                  : suppressSorted(boxes, maxOut, params, kept.data());
+    kept.resize(count);
+    return kept;
+}
+
+}  // namespace
+
+// the boxes share the side x = 1
+TEST(NmsCommonTests, TouchingBoxesOverlapOnlyWithOffset) {
+    IoUParams params;
+    params.offset = 0.f;
+    EXPECT_EQ(0.f, computeIoU(makeBox(0, 0, 1, 1, 0), makeBox(1, 0, 2, 1, 0), params));
+
+    // pixel coordinates: the shared column is one pixel wide, the intersection is 1 x 2 of 2 x 2 boxes
+    params.offset = 1.f;
+    EXPECT_FLOAT_EQ(2.f / 6.f, computeIoU(makeBox(0, 0, 1, 1, 1), makeBox(1, 0, 2, 1, 1), params));
+}
+
+// the gap between the boxes is less than the offset
+TEST(NmsCommonTests, SeparatedBoxesOverlapIfTouchIsNotRequired) {
+    const Box a = makeBox(0, 0, 1, 1, 1);
+    const Box b = makeBox(1.5f, 0, 2.5f, 1, 1);
+    IoUParams params;
+    params.offset = 1.f;
+
+    params.touchRequired = true;
+    EXPECT_EQ(0.f, computeIoU(a, b, params));
+
+    // the intersection is 0.5 x 2, the areas are 4
+    params.touchRequired = false;
+    EXPECT_FLOAT_EQ(1.f / 7.f, computeIoU(a, b, params));
+}
+
+TEST(NmsCommonTests, InclusiveThresholdSuppressesEqualIoU) {
+    BoxSet kept;
+    kept.push_back(makeBox(0, 0, 3, 1, 0));
+    // the intersection is 2, the union is 4
+    const Box box = makeBox(1, 0, 4, 1, 0);
+
+    SuppressParams params;
+    params.threshold = 0.5f;
+    params.inclusive = true;
+    EXPECT_TRUE(isSuppressed(box, kept, params));
+
+    params.inclusive = false;
+    EXPECT_FALSE(isSuppressed(box, kept, params));
+}
+
+TEST(NmsCommonTests, EqualScoresAreOrderedByIndex) {
+    const std::vector<float> scores = {0.5f, 0.9f, 0.5f, 0.1f, 0.9f, 0.5f, 0.5f};
+    std::vector<int> indices;
+
+    ASSERT_EQ(7u, selectTopK(scores.data(), scores.size(), 0.f, false, 10, indices));
+    EXPECT_EQ(std::vector<int>({1, 4, 0, 2, 5, 6, 3}), indices);
+
+    // the cut goes through the equal scores
+    ASSERT_EQ(4u, selectTopK(scores.data(), scores.size(), 0.f, false, 4, indices));
+    EXPECT_EQ(std::vector<int>({1, 4, 0, 2}), indices);
+
+    ASSERT_EQ(2u, selectTopK(scores.data(), scores.size(), 0.9f, true, 4, indices));
+    EXPECT_EQ(std::vector<int>({1, 4}), indices);
+    ASSERT_EQ(0u, selectTopK(scores.data(), scores.size(), 0.9f, false, 4, indices));
+}
+
+TEST(NmsCommonTests, EqualBoxesKeepTheFirstOne) {
+    BoxSet boxes;
+    for (int i = 0; i < 5; i++)
+        boxes.push_back(makeBox(0, 0, 2, 2, 0));
+    SuppressParams params;
+    params.threshold = 0.5f;
+
+    EXPECT_EQ(std::vector<int>({0}), suppress(boxes, 10, params, false));
+    EXPECT_EQ(std::vector<int>({0}), suppress(boxes, 10, params, true));
+}
+
+// suppressSortedParallel() builds the pairwise mask for sets of up to 8192 boxes if many boxes may be kept,
+// otherwise it falls back to the greedy search, both must keep the same boxes
+TEST(NmsCommonTests, ParallelSuppressionMatchesGreedyAroundFallbackThreshold) {
+    for (const size_t num : {100, 8192, 8193}) {
+        for (const size_t maxOut : {size_t(1), size_t(10), num}) {
+            for (const bool inclusive : {false, true}) {
+                const BoxSet boxes = makeRandomBoxes(num, 1.f, static_cast<unsigned>(num + maxOut));
+                SuppressParams params;
+                params.threshold = 0.3f;
+                params.inclusive = inclusive;
+                params.iou.offset = 1.f;
+                params.iou.touchRequired = false;
+
+                const auto expected = suppress(boxes, maxOut, params, false);
+                EXPECT_EQ(expected, suppress(boxes, maxOut, params, true))
+                    << "boxes: " << num << ", max output: " << maxOut << ", inclusive: " << inclusive;
+                EXPECT_LE(expected.size(), maxOut);
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace MKLDNNPlugin;
+
+TEST(PerfCountTests, Empty) {
+    PerfCount counter;
+    ASSERT_EQ(counter.count(), 0u);
+    ASSERT_EQ(counter.avg(), 0u);
+    ASSERT_EQ(counter.max(), 0u);
+    ASSERT_EQ(counter.percentile(99), 0u);
+    for (size_t i = 0; i < PerfCount::histogramSize; i++) {
+        ASSERT_EQ(counter.bucket(i), 0u);
+    }
+}
+
+TEST(PerfCountTests, Histogram) {
+    PerfCount counter;
+    constexpr size_t iterations = 10;
+    for (size_t i = 0; i < iterations; i++) {
+        PerfHelper helper(counter);
+        std::this_thread::sleep_for(std::chrono::microseconds(i == iterations - 1 ? 5000 : 10));
+    }
+
+    ASSERT_EQ(counter.count(), iterations);
+    uint32_t total = 0;
+    for (size_t i = 0; i < PerfCount::histogramSize; i++) {
+        total += counter.bucket(i);
+    }
+    ASSERT_EQ(total, iterations);
+
+    // the only slow iteration defines the tail
+    ASSERT_GE(counter.max(), 5000u);
+    ASSERT_LE(counter.percentile(50), counter.percentile(99));
+    ASSERT_LE(counter.percentile(50), counter.max());
+    ASSERT_EQ(counter.percentile(100), counter.max());
+}
+
+TEST(PerfCountTests, BucketBounds) {
+    ASSERT_EQ(PerfCount::bucketUpperBound(0), 0u);
+    ASSERT_EQ(PerfCount::bucketUpperBound(1), 1u);
+    ASSERT_EQ(PerfCount::bucketUpperBound(2), 3u);
+    ASSERT_EQ(PerfCount::bucketUpperBound(10), 1023u);
+}
+
+TEST(PerfCountTests, PrepareParams) {
+    PerfCount counter;
+    counter.addPrepareParams(std::chrono::high_resolution_clock::now(), 1);
+    counter.addPrepareParams(std::chrono::high_resolution_clock::now(), 0);
+    ASSERT_EQ(counter.prepareParamsCount(), 2u);
+    ASSERT_EQ(counter.cacheMisses(), 1u);
+}
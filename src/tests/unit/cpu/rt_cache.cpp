@@ -231,6 +231,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+    ASSERT_EQ(cache.getMissesCount(), 2 * capacity);
 
     //always hit
     for (int i = 0; i < capacity; ++i) {
@@ -243,6 +244,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Hit);
     }
+    ASSERT_EQ(cache.getMissesCount(), 2 * capacity);
 
     //new values displace old ones
     for (int i = capacity; i < 2 * capacity; ++i) {
@@ -255,6 +257,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+    ASSERT_EQ(cache.getMissesCount(), 4 * capacity);
 
     //can not hit the old ones
     for (int i = 0; i < capacity; ++i) {
@@ -267,6 +270,7 @@ TEST(MultiCacheTests, GetOrCreate) {
         ASSERT_EQ(*strResult.first, std::to_string(i));
         ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
     }
+    ASSERT_EQ(cache.getMissesCount(), 6 * capacity);
 }
 
 TEST(MultiCacheTests, Empty) {
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/pwl_activations.hpp"
+
+namespace {
+
+// activation, lower bound, upper bound, reference function
+using PwlActivationParams = std::tuple<DnnActivationType, double, double, double (*)(double)>;
+
+class PwlActivationsTest : public ::testing::TestWithParam<PwlActivationParams> {};
+
+TEST_P(PwlActivationsTest, AccurateWithinFewUlp) {
+    DnnActivationType type;
+    double lower, upper;
+    double (*reference)(double);
+    std::tie(type, lower, upper, reference) = GetParam();
+
+    constexpr size_t size = 100003;
+    std::vector<float> input(size), output(size);
+    for (size_t i = 0; i < size; i++) {
+        input[i] = static_cast<float>(lower + (upper - lower) * i / (size - 1));
+    }
+
+    ASSERT_TRUE(GNAPluginNS::runtime::pwl_is_vectorized_activation(type));
+    GNAPluginNS::runtime::XARCH::pwl_apply_activation(type, input.data(), output.data(), size);
+
+    for (size_t i = 0; i < size; i++) {
+        const double expected = reference(input[i]);
+        const double tolerance = 4 * std::numeric_limits<float>::epsilon() * (std::max)(std::fabs(expected), 1e-30);
+        ASSERT_NEAR(expected, output[i], tolerance) << "input: " << input[i];
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(GnaRuntime, PwlActivationsTest,
+    ::testing::Values(
+        PwlActivationParams{kActSigmoid, -20.0, 20.0, [](double x) { return 1.0 / (1.0 + std::exp(-x)); }},
+        PwlActivationParams{kActTanh, -10.0, 10.0, [](double x) { return std::tanh(x); }},
+        PwlActivationParams{kActExp, -100.0, 88.0, [](double x) { return std::exp(x); }},
+        PwlActivationParams{kActLog, 1e-6, 3000.0, [](double x) { return std::log(x); }},
+        PwlActivationParams{kActNegLog, 1e-6, 3000.0, [](double x) { return -std::log(x); }},
+        PwlActivationParams{kActNegHalfLog, 1e-6, 3000.0, [](double x) { return -0.5 * std::log(x); }},
+        PwlActivationParams{kActSoftSign, -10.0, 10.0, [](double x) { return x / (1.0 + std::fabs(x)); }}));
+
+TEST(PwlActivationsSpecialValuesTest, LimitsAndDomain) {
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> input = {0.0f, -1.0f, inf, 1000.0f, -1000.0f};
+    std::vector<float> output(input.size());
+
+    GNAPluginNS::runtime::XARCH::pwl_apply_activation(kActLog, input.data(), output.data(), 3);
+    EXPECT_EQ(-inf, output[0]);
+    EXPECT_TRUE(std::isnan(output[1]));
+    EXPECT_EQ(inf, output[2]);
+
+    GNAPluginNS::runtime::XARCH::pwl_apply_activation(kActExp, input.data() + 3, output.data(), 2);
+    EXPECT_EQ(inf, output[0]);
+    EXPECT_EQ(0.0f, output[1]);
+
+    GNAPluginNS::runtime::XARCH::pwl_apply_activation(kActTanh, input.data() + 3, output.data(), 2);
+    EXPECT_EQ(1.0f, output[0]);
+    EXPECT_EQ(-1.0f, output[1]);
+}
+
+}  // namespace
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "runtime/sgemm_blocked.hpp"
+#include "common_test_utils/data_utils.hpp"
+
+namespace {
+
+// M, N, K
+using SgemmBlockedParams = std::tuple<size_t, size_t, size_t>;
+
+class SgemmBlockedTest : public ::testing::TestWithParam<SgemmBlockedParams> {};
+
+TEST_P(SgemmBlockedTest, BitExactWithReference) {
+    size_t M, N, K;
+    std::tie(M, N, K) = GetParam();
+
+    std::vector<float> A(M * K), B(K * N), C(M * N);
+    CommonTestUtils::fill_data_random(A.data(), A.size(), 2000, -1000, 1000, 1);
+    CommonTestUtils::fill_data_random(B.data(), B.size(), 2000, -1000, 1000, 2);
+    CommonTestUtils::fill_data_random(C.data(), C.size(), 2000, -1000, 1000, 3);
+
+    std::vector<float> reference(C);
+    for (size_t i = 0; i < M; i++) {
+        for (size_t j = 0; j < N; j++) {
+            float sum = reference[i * N + j];
+            for (size_t k = 0; k < K; k++) {
+                sum += A[i * K + k] * B[k * N + j];
+            }
+            reference[i * N + j] = sum;
+        }
+    }
+
+    GNAPluginNS::runtime::XARCH::sgemm_blocked(M, N, K, A.data(), K, B.data(), N, C.data(), N);
+
+    ASSERT_EQ(0, std::memcmp(C.data(), reference.data(), C.size() * sizeof(float)));
+}
+
+INSTANTIATE_TEST_SUITE_P(GnaRuntime, SgemmBlockedTest,
+                         ::testing::Values(SgemmBlockedParams{1, 1, 1},
+                                           SgemmBlockedParams{7, 3, 300},
+                                           SgemmBlockedParams{1024, 1, 600},
+                                           SgemmBlockedParams{33, 17, 513},
+                                           SgemmBlockedParams{64, 40, 1000}));
+
+}  // namespace
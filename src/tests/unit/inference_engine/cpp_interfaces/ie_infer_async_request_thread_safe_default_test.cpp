@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <deque>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -11,6 +16,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include <cpp/ie_infer_async_request_base.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
+#include <threading/ie_immediate_executor.hpp>
 
 #include "unit_test_utils/mocks/cpp_interfaces/mock_task_executor.hpp"
 #include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
@@ -47,6 +53,11 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct EmptyInferRequest : public IInferRequestInternal {
+    EmptyInferRequest() : IInferRequestInternal(InputsDataMap{}, OutputsDataMap{}) {}
+    void InferImpl() override {}
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<AsyncInferRequestThreadSafeDefault> testRequest;
@@ -194,3 +205,86 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+// IsReady
+TEST_F(InferRequestThreadSafeDefaultTests, canPollRequestWithoutCallback) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    ASSERT_TRUE(testRequest->IsReady());
+    ASSERT_EQ(INFER_NOT_STARTED, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    testRequest->StartAsync();
+    ASSERT_FALSE(testRequest->IsReady());
+    ASSERT_EQ(RESULT_NOT_READY, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    taskExecutor->executeAll();
+    ASSERT_TRUE(testRequest->IsReady());
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canWaitRequestsFromCallback) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(std::make_shared<EmptyInferRequest>(),
+                                                                  taskExecutor, taskExecutor);
+    constexpr int numRequests = 1000;
+    std::atomic<int> numCompleted{0};
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr) {
+        ASSERT_EQ(nullptr, exceptionPtr);
+        if (++numCompleted < numRequests) {
+            testRequest->StartAsync();
+        }
+    });
+    testRequest->StartAsync();
+    while (numCompleted < numRequests) {
+        testRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, canDestroyRequestRestartedFromCallback) {
+    // two streams, so the restarted pipeline completes while the callback of the first one is still running
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"RestartFromCallback", 2});
+    auto request = make_shared<AsyncInferRequestThreadSafeDefault>(std::make_shared<EmptyInferRequest>(),
+                                                                   taskExecutor, std::make_shared<ImmediateExecutor>());
+    auto rawRequest = request.get();
+    std::atomic<bool> restarted{false};
+    std::atomic<bool> firstCallbackReturned{false};
+    request->SetCallback([&, rawRequest](std::exception_ptr) {
+        rawRequest->StartAsync();
+        restarted = true;
+        rawRequest->Wait(InferRequest::WaitMode::RESULT_READY);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        firstCallbackReturned = true;
+    });
+    request->StartAsync();
+    while (!restarted) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(OK, request->Wait(InferRequest::WaitMode::RESULT_READY));
+    // the destructor must wait for the last stage of the first pipeline, it touches the request after the callback
+    request.reset();
+    ASSERT_TRUE(firstCallbackReturned);
+}
+
+// Microbenchmark: with immediate executors the measured time is the overhead of the request pipeline itself,
+// the executors used by plugins (e.g. CPUStreamsExecutor) add their own cost of queueing a task
+TEST_F(InferRequestThreadSafeDefaultTests, perRequestOverheadStaysFlat) {
+    auto executor = std::make_shared<ImmediateExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(std::make_shared<EmptyInferRequest>(), executor, executor);
+    constexpr size_t numChunks = 10;
+    constexpr size_t chunkSize = 20000;
+    std::vector<double> chunkNs;
+    for (size_t chunk = 0; chunk < numChunks; chunk++) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < chunkSize; i++) {
+            testRequest->StartAsync();
+            ASSERT_TRUE(testRequest->IsReady());
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        chunkNs.push_back(std::chrono::duration<double, std::nano>(elapsed).count() / chunkSize);
+    }
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+    const auto fastest = *std::min_element(chunkNs.begin(), chunkNs.end());
+    RecordProperty("ns_per_request", std::to_string(fastest));
+    // generous bound, intended to catch overhead growing with the number of requests, not timing noise
+    ASSERT_LT(chunkNs.back(), 4 * fastest + 1000.0);
+}
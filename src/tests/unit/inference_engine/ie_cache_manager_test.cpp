@@ -0,0 +1,223 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#    include <unistd.h>
+#    include <utime.h>
+#else
+#    include <process.h>
+#    include <sys/utime.h>
+#endif
+
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std::chrono;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    static std::string generateTestDirName() {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::string testName = testInfo->test_case_name();
+        testName += testInfo->name();
+        std::stringstream ss;
+        auto ts = duration_cast<microseconds>(high_resolution_clock::now().time_since_epoch());
+        ss << std::hash<std::string>()(testName) << "_" << std::this_thread::get_id() << "_" << ts.count() << "_cache";
+        return ss.str();
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, const std::string& content) {
+        manager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    static std::string read(ICacheManager& manager, const std::string& id) {
+        std::string content;
+        manager.readCacheEntry(id, [&](std::istream& stream) {
+            std::stringstream ss;
+            ss << stream.rdbuf();
+            content = ss.str();
+        });
+        return content;
+    }
+
+    std::string createFile(const std::string& name, const std::string& content) const {
+        const auto path = FileUtils::makePath(m_cacheDir, name);
+        std::ofstream(path, std::ios_base::binary) << content;
+        return path;
+    }
+
+    static void setModificationTime(const std::string& path, std::time_t time) {
+#ifndef _WIN32
+        struct utimbuf times = {time, time};
+        utime(path.c_str(), &times);
+#else
+        struct _utimbuf times = {time, time};
+        _utime(path.c_str(), &times);
+#endif
+    }
+
+    static std::string currentPid() {
+#ifndef _WIN32
+        return std::to_string(getpid());
+#else
+        return std::to_string(_getpid());
+#endif
+    }
+
+    void SetUp() override {
+        m_cacheDir = generateTestDirName();
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteAndReadEntry) {
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    write(manager, "model", "compiled blob");
+
+    EXPECT_EQ("compiled blob", read(manager, "model"));
+    EXPECT_EQ(13, manager.getCacheSize());
+    // only the final blob is left in the cache directory, temporary file is renamed
+    EXPECT_EQ(1, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+    EXPECT_EQ(0, CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size());
+}
+
+TEST_F(FileStorageCacheManagerTests, ReadEntryWithSeeking) {
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    write(manager, "model", "0123456789");
+
+    std::string content;
+    static_cast<ICacheManager&>(manager).readCacheEntry("model", [&](std::istream& stream) {
+        stream.seekg(4);
+        EXPECT_EQ(4, stream.tellg());
+        char c;
+        stream.read(&c, 1);
+        content += c;
+        stream.seekg(-2, std::ios_base::end);
+        stream >> content;
+        EXPECT_TRUE(stream.eof());
+    });
+    EXPECT_EQ("89", content);
+}
+
+TEST_F(FileStorageCacheManagerTests, MissingEntryIsNotRead) {
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    bool called = false;
+    static_cast<ICacheManager&>(manager).readCacheEntry("model", [&](std::istream&) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteLeavesNoFiles) {
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    EXPECT_ANY_THROW(static_cast<ICacheManager&>(manager).writeCacheEntry("model", [](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }));
+    EXPECT_EQ(0, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+    EXPECT_EQ(0, CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size());
+    EXPECT_EQ(0, manager.getCacheSize());
+}
+
+TEST_F(FileStorageCacheManagerTests, RemoveEntry) {
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    write(manager, "model", "compiled blob");
+    static_cast<ICacheManager&>(manager).removeCacheEntry("model");
+
+    EXPECT_EQ(0, manager.getCacheSize());
+    EXPECT_EQ(0, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+}
+
+TEST_F(FileStorageCacheManagerTests, LeastRecentlyUsedEntriesAreEvicted) {
+    FileStorageCacheManager manager{std::string(m_cacheDir), 25};
+    write(manager, "a", std::string(10, 'a'));
+    write(manager, "b", std::string(10, 'b'));
+    // "a" becomes the most recently used entry
+    EXPECT_EQ(std::string(10, 'a'), read(manager, "a"));
+    write(manager, "c", std::string(10, 'c'));
+
+    EXPECT_EQ(1, manager.getEvictionsCount());
+    EXPECT_EQ(20, manager.getCacheSize());
+    EXPECT_TRUE(read(manager, "b").empty());
+    EXPECT_EQ(std::string(10, 'a'), read(manager, "a"));
+    EXPECT_EQ(std::string(10, 'c'), read(manager, "c"));
+}
+
+TEST_F(FileStorageCacheManagerTests, ExistingEntriesAreAccounted) {
+    {
+        FileStorageCacheManager manager{std::string(m_cacheDir)};
+        write(manager, "a", std::string(10, 'a'));
+        write(manager, "b", std::string(10, 'b'));
+    }
+    FileStorageCacheManager manager{std::string(m_cacheDir), 15};
+    EXPECT_EQ(10, manager.getCacheSize());
+    EXPECT_EQ(1, manager.getEvictionsCount());
+    EXPECT_EQ(1, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+}
+
+TEST_F(FileStorageCacheManagerTests, ReadEntriesAreKeptByOtherProcesses) {
+    const auto now = std::time(nullptr);
+    {
+        FileStorageCacheManager manager{std::string(m_cacheDir)};
+        write(manager, "a", std::string(10, 'a'));
+        write(manager, "b", std::string(10, 'b'));
+    }
+    setModificationTime(FileUtils::makePath(m_cacheDir, std::string("a.blob")), now - 20);
+    setModificationTime(FileUtils::makePath(m_cacheDir, std::string("b.blob")), now - 10);
+    {
+        // "a" is written earlier, but used later than "b"
+        FileStorageCacheManager manager{std::string(m_cacheDir)};
+        EXPECT_EQ(std::string(10, 'a'), read(manager, "a"));
+    }
+    FileStorageCacheManager manager{std::string(m_cacheDir), 15};
+    EXPECT_EQ(1, manager.getEvictionsCount());
+    EXPECT_EQ(std::string(10, 'a'), read(manager, "a"));
+    EXPECT_TRUE(read(manager, "b").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, StaleTempFilesAreRemoved) {
+    // the process doesn't exist
+    createFile("a.blob.999999999.0.tmp", std::string(10, 'a'));
+    // the process id is reused by a live process
+    const auto reused = createFile("b.blob." + currentPid() + ".0.tmp", std::string(10, 'b'));
+    setModificationTime(reused, std::time(nullptr) - 2 * 24 * 60 * 60);
+
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    EXPECT_EQ(0, manager.getCacheSize());
+    EXPECT_EQ(0, CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size());
+}
+
+TEST_F(FileStorageCacheManagerTests, TempFilesOfLiveProcessesAreAccounted) {
+    createFile("a.blob", std::string(5, 'a'));
+    createFile("a.blob." + currentPid() + ".0.tmp", std::string(10, 'a'));
+    createFile("b.blob." + currentPid() + ".1.tmp", std::string(10, 'b'));
+    // not a temporary file of the cache manager
+    createFile("c.blob.tmp", std::string(10, 'c'));
+
+    FileStorageCacheManager manager{std::string(m_cacheDir)};
+    EXPECT_EQ(20, manager.getCacheSize());
+    EXPECT_EQ(3, CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").size());
+}
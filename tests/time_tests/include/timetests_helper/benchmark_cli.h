@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+#include <string>
+
+/**
+ * @file benchmark_cli.h
+ * Options common for the benchmarks which write JSON statistics. The flags are defined here,
+ * so the header should be included by the only source file of an executable.
+ */
+
+/// @brief message for help argument
+static const char help_message[] = "Print a usage message.";
+
+/// @brief message for target device argument
+static const char target_device_message[] = "Required. Specify a target device to run the benchmark on.";
+
+/// @brief message for statistics path argument
+static const char statistics_path_message[] = "Required. Path to a file to write statistics in JSON format.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set target device <br>
+/// It is a required parameter
+DEFINE_string(d, "", target_device_message);
+
+/// @brief Define parameter for set path to a file to write statistics <br>
+/// It is a required parameter
+DEFINE_string(s, "", statistics_path_message);
+
+namespace TimeTest {
+/**
+ * @brief Prints the usage header and the common options, a benchmark prints its own options after them
+ */
+inline void showBenchmarkUsage(const std::string &name) {
+  std::cout << std::endl;
+  std::cout << name << " [OPTION]" << std::endl;
+  std::cout << "Options:" << std::endl;
+  std::cout << std::endl;
+  std::cout << "    -h, --help                " << help_message << std::endl;
+  std::cout << "    -d \"<device>\"             " << target_device_message << std::endl;
+  std::cout << "    -s \"<path>\"               " << statistics_path_message << std::endl;
+}
+
+/**
+ * @brief Parses command line, shows the usage if it is requested or the common required options are not set
+ * @return false if the benchmark should not be run, `FLAGS_h || FLAGS_help` tells whether it is an error
+ */
+template <typename ShowUsage>
+bool parseBenchmarkCommandLine(int argc, char **argv, const ShowUsage &showUsage) {
+  gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+  if (FLAGS_help || FLAGS_h || FLAGS_d.empty() || FLAGS_s.empty()) {
+    showUsage();
+    return false;
+  }
+  return true;
+}
+} // namespace TimeTest
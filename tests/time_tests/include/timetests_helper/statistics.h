@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace TimeTest {
+/**
+ * @brief Collects durations of named measurements of a benchmark and writes their minimum, median
+ * and maximum in JSON format.
+ */
+class DurationStatistics {
+public:
+  /// Adds a duration of the measurement in milliseconds.
+  void add(const std::string &name, double duration);
+
+  /// Sets an additional field of the measurement, the maximum of the set values is written.
+  void setMax(const std::string &name, const std::string &field, size_t value);
+
+  /**
+   * @brief Writes the info fields, which values are JSON values, and the measurements as an array
+   * @param entries - name of the array of the measurements
+   */
+  void writeJson(std::ostream &out, const std::string &entries, const std::map<std::string, std::string> &info) const;
+
+private:
+  std::vector<std::string> order;
+  std::map<std::string, std::vector<double>> durations;
+  std::map<std::string, std::map<std::string, size_t>> fields;
+};
+
+/// Returns the value as a JSON string.
+std::string quoted(const std::string &value);
+
+/// Writes the statistics to the file, reports an error and returns false if the file can't be written.
+bool writeStatistics(const std::string &path, const DurationStatistics &statistics, const std::string &entries,
+                     const std::map<std::string, std::string> &info);
+} // namespace TimeTest
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+This script aggregates durations of internal stages of the plugins (graph
+creation, transformations) from a Chrome trace written by OpenVINO built with
+ENABLE_PROFILING_ITT and adds them to load_benchmark statistics.
+"""
+
+import argparse
+import json
+import logging
+import re
+import sys
+
+from pathlib import Path
+from pprint import pprint
+
+
+def read_trace_durations(trace_path: Path, categories: list, name_pattern: str):
+    """Collect durations (in milliseconds) of complete events grouped by category and name"""
+    with open(trace_path) as file:
+        events = json.load(file)["traceEvents"]
+
+    name_regex = re.compile(name_pattern)
+    durations = {}
+    for event in events:
+        if event.get("ph") != "X":
+            continue
+        if categories and event.get("cat") not in categories:
+            continue
+        if not name_regex.fullmatch(event["name"]):
+            continue
+        # Chrome trace durations are in microseconds
+        durations.setdefault((event.get("cat", ""), event["name"]), []).append(event["dur"] / 1000)
+    return durations
+
+
+def aggregate_durations(durations: dict):
+    """Aggregate durations to the format of load_benchmark stages"""
+    stages = []
+    for (category, name), values in durations.items():
+        values = sorted(values)
+        stages.append({"name": name, "category": category, "iterations": len(values),
+                       "min": values[0], "median": values[len(values) // 2], "max": values[-1]})
+    return stages
+
+
+def cli_parser():
+    """Parse command-line arguments"""
+    parser = argparse.ArgumentParser(description="Aggregate internal stages of the plugins from a Chrome trace")
+    parser.add_argument("trace", type=Path,
+                        help="path to a trace written to OPENVINO_TRACE_FILE")
+    parser.add_argument("-s", "--stats", type=Path,
+                        help="path to a load_benchmark statistics file to add the internal stages to")
+    parser.add_argument("--categories", nargs="*", default=[],
+                        help="ITT domains to aggregate, all if not set")
+    parser.add_argument("--names", default="CreateGraph|.*Transformations",
+                        help="regular expression of task names to aggregate")
+    return parser.parse_args()
+
+
+if __name__ == "__main__":
+    args = cli_parser()
+    logging.basicConfig(format="[ %(levelname)s ] %(message)s", level=logging.INFO, stream=sys.stdout)
+
+    stages = aggregate_durations(read_trace_durations(args.trace, args.categories, args.names))
+    if not stages:
+        logging.error(f"No tasks matching '{args.names}' found in '{args.trace}'. "
+                      "Check that OpenVINO is built with ENABLE_PROFILING_ITT")
+        sys.exit(1)
+
+    if args.stats:
+        with open(args.stats) as file:
+            stats = json.load(file)
+        stats["internal_stages"] = stages
+        with open(args.stats, "w") as file:
+            json.dump(stats, file, indent=2)
+        logging.info(f"Internal stages added to a file: '{args.stats.resolve()}'")
+    else:
+        pprint(stages)
+
+
+def test_trace_durations_aggregation(tmp_path):
+    trace = {"displayTimeUnit": "ms", "traceEvents": [
+        {"name": "thread_name", "ph": "M", "pid": 1, "tid": 2, "args": {"name": "main"}},
+        {"name": "CreateGraph", "cat": "MKLDNN_LT", "ph": "X", "pid": 1, "tid": 2, "ts": 0, "dur": 3000},
+        {"name": "CreateGraph", "cat": "MKLDNN_LT", "ph": "X", "pid": 1, "tid": 2, "ts": 0, "dur": 1000},
+        {"name": "CreateGraph", "cat": "MKLDNN_LT", "ph": "X", "pid": 1, "tid": 3, "ts": 0, "dur": 2000},
+        {"name": "LowPrecisionTransformations", "cat": "MKLDNN_LT", "ph": "X", "pid": 1, "tid": 2, "ts": 0,
+         "dur": 500},
+        {"name": "ConstantFolding", "cat": "nGraph", "ph": "X", "pid": 1, "tid": 2, "ts": 0, "dur": 10}]}
+    trace_path = tmp_path / "trace.json"
+    trace_path.write_text(json.dumps(trace))
+
+    stages = aggregate_durations(read_trace_durations(trace_path, [], "CreateGraph|.*Transformations"))
+
+    assert stages == [
+        {"name": "CreateGraph", "category": "MKLDNN_LT", "iterations": 3, "min": 1, "median": 2, "max": 3},
+        {"name": "LowPrecisionTransformations", "category": "MKLDNN_LT", "iterations": 1,
+         "min": 0.5, "median": 0.5, "max": 0.5}], "Trace durations are aggregated incorrectly!"
+    assert read_trace_durations(trace_path, ["nGraph"], "CreateGraph") == {}
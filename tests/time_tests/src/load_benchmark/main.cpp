@@ -0,0 +1,264 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_plugin_config.hpp>
+#include <openvino/op/constant.hpp>
+#include <openvino/openvino.hpp>
+#include <openvino/pass/serialize.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#endif
+
+#include "synthetic_model.h"
+#include "timetests_helper/benchmark_cli.h"
+#include "timetests_helper/statistics.h"
+
+/// @brief message for model argument
+static const char model_message[] =
+    "Optional. Path to an .xml/.onnx file with a model. If not set, a synthetic model is generated.";
+
+/// @brief message for iterations argument
+static const char iterations_message[] = "Optional. Number of measured iterations of every stage. Default is 5.";
+
+/// @brief message for layers argument
+static const char layers_message[] = "Optional. Number of Convolution + Add + Relu blocks of the synthetic model.";
+
+/// @brief message for weights size argument
+static const char weights_message[] = "Optional. Approximate size of the synthetic model constants in megabytes.";
+
+/// @brief message for spatial size argument
+static const char spatial_message[] = "Optional. Height and width of the synthetic model input.";
+
+/// @brief message for dynamic batch argument
+static const char dynamic_message[] = "Optional. Use dynamic batch dimension in the synthetic model input.";
+
+/// @brief message for cache argument
+static const char cache_message[] = "Optional. Measure compilation with models cache (cache miss and cache hit).";
+
+/// @brief message for working directory argument
+static const char work_dir_message[] =
+    "Optional. Directory for the serialized synthetic model, exported blobs and models cache. Default is current.";
+
+DEFINE_string(m, "", model_message);
+DEFINE_uint32(niter, 5, iterations_message);
+DEFINE_uint32(layers, 100, layers_message);
+DEFINE_uint32(weights_mb, 64, weights_message);
+DEFINE_uint32(spatial, 32, spatial_message);
+DEFINE_bool(dynamic, false, dynamic_message);
+DEFINE_bool(cache, false, cache_message);
+DEFINE_string(work_dir, ".", work_dir_message);
+
+namespace {
+
+void showUsage() {
+  TimeTest::showBenchmarkUsage("load_benchmark");
+  std::cout << "    -m \"<path>\"               " << model_message << std::endl;
+  std::cout << "    -niter <number>           " << iterations_message << std::endl;
+  std::cout << "    -layers <number>          " << layers_message << std::endl;
+  std::cout << "    -weights_mb <number>      " << weights_message << std::endl;
+  std::cout << "    -spatial <number>         " << spatial_message << std::endl;
+  std::cout << "    -dynamic                  " << dynamic_message << std::endl;
+  std::cout << "    -cache                    " << cache_message << std::endl;
+  std::cout << "    -work_dir \"<path>\"        " << work_dir_message << std::endl;
+}
+
+/**
+ * @brief Returns peak resident set size of the process in kilobytes
+ */
+size_t getPeakRSSInKB() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS pmc;
+  pmc.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+  GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb);
+  return pmc.PeakWorkingSetSize / 1024;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;  // bytes on macOS
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/**
+ * @brief Measures a stage of the pipeline: its duration and the growth of the process peak RSS during the stage.
+ * Peak RSS never decreases, so a stage shows a growth only if it needs more memory than all the previous stages.
+ */
+template <typename Func>
+void measure(TimeTest::DurationStatistics &statistics, const std::string &stage, Func &&func) {
+  const size_t peakRSSBefore = getPeakRSSInKB();
+  const auto start = std::chrono::steady_clock::now();
+  func();
+  const auto end = std::chrono::steady_clock::now();
+  const size_t peakRSSAfter = getPeakRSSInKB();
+
+  statistics.add(stage, std::chrono::duration<double, std::milli>(end - start).count());
+  statistics.setMax(stage, "peak_rss_growth_kb", peakRSSAfter - peakRSSBefore);
+}
+
+size_t getFileSize(const std::string &path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  return file.good() ? static_cast<size_t>(file.tellg()) : 0;
+}
+
+std::string joinPath(const std::string &dir, const std::string &name) {
+  return dir.empty() ? name : dir + "/" + name;
+}
+
+/**
+ * @brief Removes regular files of the directory, so every iteration starts with an empty models cache
+ */
+void clearDirectory(const std::string &dir) {
+#ifdef _WIN32
+  WIN32_FIND_DATAA data;
+  HANDLE handle = FindFirstFileA(joinPath(dir, "*").c_str(), &data);
+  if (handle == INVALID_HANDLE_VALUE)
+    return;
+  do {
+    if (!(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+      std::remove(joinPath(dir, data.cFileName).c_str());
+  } while (FindNextFileA(handle, &data));
+  FindClose(handle);
+#else
+  DIR *directory = opendir(dir.c_str());
+  if (directory == nullptr)
+    return;
+  while (struct dirent *entry = readdir(directory)) {
+    const std::string path = joinPath(dir, entry->d_name);
+    struct stat sb;
+    if (stat(path.c_str(), &sb) == 0 && S_ISREG(sb.st_mode))
+      std::remove(path.c_str());
+  }
+  closedir(directory);
+#endif
+}
+
+void runPipeline(const std::string &modelPath, const std::string &device, TimeTest::DurationStatistics &statistics) {
+  const std::string blobPath = joinPath(FLAGS_work_dir, "load_benchmark.blob");
+
+  for (uint32_t iteration = 0; iteration < FLAGS_niter; iteration++) {
+    std::shared_ptr<ov::Model> model;
+    ov::runtime::CompiledModel compiledModel;
+    {
+      // the plugin is loaded once per Core, separately from model compilation
+      ov::runtime::Core core;
+      measure(statistics, "load_plugin", [&] { core.get_versions(device); });
+      measure(statistics, "read_model", [&] { model = core.read_model(modelPath); });
+      measure(statistics, "compile_model", [&] { compiledModel = core.compile_model(model, device); });
+      measure(statistics, "export_model", [&] {
+        std::ofstream blob(blobPath, std::ios::binary);
+        compiledModel.export_model(blob);
+      });
+      compiledModel = {};
+      measure(statistics, "import_model", [&] {
+        std::ifstream blob(blobPath, std::ios::binary);
+        compiledModel = core.import_model(blob, device);
+      });
+      compiledModel = {};
+    }
+    std::remove(blobPath.c_str());
+
+    if (FLAGS_cache) {
+      const std::string cacheDir = joinPath(FLAGS_work_dir, "load_benchmark_cache");
+      clearDirectory(cacheDir);
+      for (const std::string stage : {"compile_model_cache_miss", "compile_model_cache_hit"}) {
+        ov::runtime::Core core;
+        core.set_config({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+        core.get_versions(device);
+        measure(statistics, stage, [&] { compiledModel = core.compile_model(modelPath, device); });
+        compiledModel = {};
+      }
+      clearDirectory(cacheDir);
+    }
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Measures read, compile, export and import of a model (or a synthetic model of configurable size)
+ * and writes per-stage timings and peak RSS to a JSON file.
+ */
+int main(int argc, char **argv) {
+  if (!TimeTest::parseBenchmarkCommandLine(argc, argv, showUsage))
+    return FLAGS_help || FLAGS_h ? 0 : -1;
+  if (FLAGS_niter == 0) {
+    showUsage();
+    return -1;
+  }
+
+  TimeTest::DurationStatistics statistics;
+  std::map<std::string, std::string> info;
+  info["device"] = TimeTest::quoted(FLAGS_d);
+
+  try {
+    std::string modelPath = FLAGS_m;
+    if (modelPath.empty()) {
+      LoadBenchmark::SyntheticModelConfig config;
+      config.layers = FLAGS_layers;
+      config.weightsBytes = static_cast<size_t>(FLAGS_weights_mb) * 1024 * 1024;
+      config.spatial = FLAGS_spatial;
+      config.dynamicBatch = FLAGS_dynamic;
+
+      modelPath = joinPath(FLAGS_work_dir, "load_benchmark_model.xml");
+      const std::string binPath = joinPath(FLAGS_work_dir, "load_benchmark_model.bin");
+      std::shared_ptr<ov::Model> model;
+      measure(statistics, "create_synthetic_model", [&] { model = LoadBenchmark::createSyntheticModel(config); });
+      measure(statistics, "serialize_model", [&] { ov::pass::Serialize(modelPath, binPath).run_on_model(model); });
+
+      // equal constants are stored once by serialization, a smaller file means the model is not of the requested size
+      size_t constantsBytes = 0;
+      for (const auto &op : model->get_ops()) {
+        if (const auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op))
+          constantsBytes += constant->get_byte_size();
+      }
+      const size_t binBytes = getFileSize(binPath);
+      if (binBytes != constantsBytes) {
+        throw std::runtime_error("Serialized weights take " + std::to_string(binBytes) + " bytes instead of " +
+                                 std::to_string(constantsBytes));
+      }
+
+      std::stringstream synthetic;
+      synthetic << "{\"layers\": " << config.layers << ", \"weights_bytes\": " << config.weightsBytes
+                << ", \"serialized_weights_bytes\": " << binBytes
+                << ", \"spatial\": " << config.spatial << ", \"dynamic_batch\": "
+                << (config.dynamicBatch ? "true" : "false") << "}";
+      info["synthetic_model"] = synthetic.str();
+    }
+    info["model"] = TimeTest::quoted(modelPath);
+
+    // internal stages of the plugins (transformations, graph creation) are recorded by ITT instrumentation
+    // into one trace of the process, scripts/trace_stages.py adds their timings to the statistics
+    if (const char *traceFile = std::getenv("OPENVINO_TRACE_FILE"))
+      info["trace_file"] = TimeTest::quoted(traceFile);
+
+    runPipeline(modelPath, FLAGS_d, statistics);
+  } catch (const std::exception &ex) {
+    std::cerr << "Load benchmark failed with exception:\n" << ex.what() << std::endl;
+    return 1;
+  }
+
+  info["peak_rss_kb"] = std::to_string(getPeakRSSInKB());
+  return TimeTest::writeStatistics(FLAGS_s, statistics, "stages", info) ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "synthetic_model.h"
+
+#include <openvino/opsets/opset8.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace LoadBenchmark {
+
+std::shared_ptr<ov::Model> createSyntheticModel(const SyntheticModelConfig &config) {
+  const size_t layers = std::max<size_t>(config.layers, 1);
+  // every layer has C * C * 3 * 3 weights and C biases
+  const double weightsPerLayer = static_cast<double>(config.weightsBytes) / sizeof(float) / layers;
+  const size_t channels = std::max<size_t>(1, static_cast<size_t>(std::sqrt(weightsPerLayer / 9)));
+
+  const ov::Dimension batch = config.dynamicBatch ? ov::Dimension::dynamic() : ov::Dimension(1);
+  auto input = std::make_shared<ov::opset8::Parameter>(
+      ov::element::f32,
+      ov::PartialShape{batch, static_cast<int64_t>(channels),
+                       static_cast<int64_t>(config.spatial), static_cast<int64_t>(config.spatial)});
+  input->set_friendly_name("input");
+
+  ov::Output<ov::Node> last = input;
+  std::vector<float> weights(channels * channels * 9);
+  std::vector<float> biases(channels);
+  for (size_t layer = 0; layer < layers; layer++) {
+    // small random values seeded by the layer, so the constants are unique and the outputs stay finite
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(layer));
+    std::uniform_real_distribution<float> weightsDistribution(0.0f, 1.0f / (9.0f * channels));
+    std::uniform_real_distribution<float> biasesDistribution(0.0f, 0.04f);
+    std::generate(weights.begin(), weights.end(), [&] { return weightsDistribution(generator); });
+    std::generate(biases.begin(), biases.end(), [&] { return biasesDistribution(generator); });
+
+    auto weightsNode = ov::opset8::Constant::create(ov::element::f32, ov::Shape{channels, channels, 3, 3}, weights);
+    auto convolution = std::make_shared<ov::opset8::Convolution>(
+        last, weightsNode, ov::Strides{1, 1}, ov::CoordinateDiff{1, 1}, ov::CoordinateDiff{1, 1}, ov::Strides{1, 1});
+    auto biasesNode = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, channels, 1, 1}, biases);
+    auto add = std::make_shared<ov::opset8::Add>(convolution, biasesNode);
+    auto relu = std::make_shared<ov::opset8::Relu>(add);
+    last = relu;
+  }
+
+  auto result = std::make_shared<ov::opset8::Result>(last);
+  return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{input}, "synthetic");
+}
+
+} // namespace LoadBenchmark
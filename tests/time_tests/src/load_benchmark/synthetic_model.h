@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/model.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace LoadBenchmark {
+
+/**
+ * @brief Parameters of a synthetic model
+ */
+struct SyntheticModelConfig {
+  size_t layers = 100;  // number of Convolution + Add + Relu blocks
+  size_t weightsBytes = 64 * 1024 * 1024;  // approximate total size of f32 constants in bytes
+  size_t spatial = 32;  // height and width of the input
+  bool dynamicBatch = false;  // use dynamic batch dimension of the input
+};
+
+/**
+ * @brief Creates a chain of 3x3 convolutions with biases and activations.
+ * The number of channels is selected to get the requested size of constants,
+ * the constants are filled with different values, so they are not deduplicated on serialization.
+ */
+std::shared_ptr<ov::Model> createSyntheticModel(const SyntheticModelConfig &config);
+
+} // namespace LoadBenchmark
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/openvino.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nms_models.h"
+#include "timetests_helper/benchmark_cli.h"
+#include "timetests_helper/statistics.h"
+
+/// @brief message for operations argument
+static const char operations_message[] =
+    "Optional. Comma separated list of operations to measure. Default is all NMS-family operations.";
+
+/// @brief message for iterations argument
+static const char iterations_message[] = "Optional. Number of measured inferences of every operation. Default is 100.";
+
+/// @brief message for warmup argument
+static const char warmup_message[] = "Optional. Number of not measured inferences before the measured ones. Default is 5.";
+
+/// @brief message for boxes argument
+static const char boxes_message[] = "Optional. Number of input boxes (anchors, priors, ROIs) per image. Default is 1000.";
+
+/// @brief message for classes argument
+static const char classes_message[] = "Optional. Number of classes of multi-class operations. Default is 20.";
+
+/// @brief message for batch argument
+static const char batch_message[] = "Optional. Number of images of batched operations. Default is 1.";
+
+DEFINE_string(op, "", operations_message);
+DEFINE_uint32(niter, 100, iterations_message);
+DEFINE_uint32(warmup, 5, warmup_message);
+DEFINE_uint32(boxes, 1000, boxes_message);
+DEFINE_uint32(classes, 20, classes_message);
+DEFINE_uint32(batch, 1, batch_message);
+
+namespace {
+
+void showUsage() {
+  TimeTest::showBenchmarkUsage("nms_benchmark");
+  std::cout << "    -op \"<op1>,<op2>\"         " << operations_message << std::endl;
+  std::cout << "    -niter <number>           " << iterations_message << std::endl;
+  std::cout << "    -warmup <number>          " << warmup_message << std::endl;
+  std::cout << "    -boxes <number>           " << boxes_message << std::endl;
+  std::cout << "    -classes <number>         " << classes_message << std::endl;
+  std::cout << "    -batch <number>           " << batch_message << std::endl;
+  std::cout << std::endl;
+  std::cout << "Operations:" << std::endl;
+  for (const auto &operation : NmsBenchmark::nmsOperations())
+    std::cout << "    " << operation << std::endl;
+}
+
+std::vector<std::string> split(const std::string &value, char delimiter) {
+  std::vector<std::string> items;
+  std::stringstream stream(value);
+  std::string item;
+  while (std::getline(stream, item, delimiter)) {
+    if (!item.empty())
+      items.push_back(item);
+  }
+  return items;
+}
+
+void measureOperation(ov::runtime::Core &core, const std::string &operation,
+                      const NmsBenchmark::NmsModelConfig &config, TimeTest::DurationStatistics &statistics) {
+  const auto benchmarkCase = NmsBenchmark::createNmsModel(operation, config);
+  auto compiledModel = core.compile_model(benchmarkCase.model, FLAGS_d);
+  auto request = compiledModel.create_infer_request();
+  for (size_t i = 0; i < benchmarkCase.inputs.size(); i++) {
+    auto tensor = request.get_input_tensor(i);
+    NmsBenchmark::fillInput(tensor, benchmarkCase.inputs[i], benchmarkCase.imageSize, static_cast<unsigned>(i));
+  }
+
+  for (uint32_t iteration = 0; iteration < FLAGS_warmup; iteration++)
+    request.infer();
+
+  // inputs are the same for every iteration, so the measured time is of the operation itself
+  for (uint32_t iteration = 0; iteration < FLAGS_niter; iteration++) {
+    const auto start = std::chrono::steady_clock::now();
+    request.infer();
+    const auto end = std::chrono::steady_clock::now();
+    statistics.add(operation, std::chrono::duration<double, std::milli>(end - start).count());
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Measures inference of single-operation models of the NMS family (NonMaxSuppression, MatrixNms,
+ * MulticlassNms, Proposal, DetectionOutput and ExperimentalDetectron operations) on synthetic boxes
+ * and writes per-operation timings to a JSON file.
+ */
+int main(int argc, char **argv) {
+  if (!TimeTest::parseBenchmarkCommandLine(argc, argv, showUsage))
+    return FLAGS_help || FLAGS_h ? 0 : -1;
+  if (FLAGS_niter == 0 || FLAGS_boxes == 0 || FLAGS_classes == 0 || FLAGS_batch == 0) {
+    showUsage();
+    return -1;
+  }
+
+  NmsBenchmark::NmsModelConfig config;
+  config.boxes = FLAGS_boxes;
+  config.classes = FLAGS_classes;
+  config.batch = FLAGS_batch;
+
+  const auto operations = FLAGS_op.empty() ? NmsBenchmark::nmsOperations() : split(FLAGS_op, ',');
+
+  TimeTest::DurationStatistics statistics;
+  std::map<std::string, std::string> info;
+  info["device"] = TimeTest::quoted(FLAGS_d);
+  std::stringstream problem;
+  problem << "{\"boxes\": " << config.boxes << ", \"classes\": " << config.classes << ", \"batch\": " << config.batch
+          << "}";
+  info["problem"] = problem.str();
+
+  try {
+    ov::runtime::Core core;
+    for (const auto &operation : operations)
+      measureOperation(core, operation, config, statistics);
+  } catch (const std::exception &ex) {
+    std::cerr << "NMS benchmark failed with exception:\n" << ex.what() << std::endl;
+    return 1;
+  }
+
+  return TimeTest::writeStatistics(FLAGS_s, statistics, "operations", info) ? 0 : 1;
+}
@@ -0,0 +1,241 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_models.h"
+
+#include <openvino/opsets/opset8.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace NmsBenchmark {
+
+namespace {
+
+using ov::opset8::Parameter;
+
+std::shared_ptr<Parameter> makeInput(const ov::Shape &shape, InputKind kind, NmsBenchmarkCase &benchmarkCase,
+                                     ov::ParameterVector &parameters) {
+  auto parameter = std::make_shared<Parameter>(ov::element::f32, shape);
+  parameter->set_friendly_name("input" + std::to_string(parameters.size()));
+  parameters.push_back(parameter);
+  benchmarkCase.inputs.push_back(kind);
+  return parameter;
+}
+
+NmsBenchmarkCase makeCase(const std::shared_ptr<ov::Node> &operation, const ov::ParameterVector &parameters,
+                          NmsBenchmarkCase benchmarkCase) {
+  ov::ResultVector results;
+  for (const auto &output : operation->outputs())
+    results.push_back(std::make_shared<ov::opset8::Result>(output));
+  benchmarkCase.model = std::make_shared<ov::Model>(results, parameters, operation->get_type_name());
+  return benchmarkCase;
+}
+
+/**
+ * @brief Side of a square feature map with at least 'boxes' anchors of 'anchors' sizes in every position
+ */
+size_t featureSide(size_t boxes, size_t anchors) {
+  return std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(boxes) / anchors))));
+}
+
+NmsBenchmarkCase nonMaxSuppression(const NmsModelConfig &config) {
+  NmsBenchmarkCase benchmarkCase;
+  ov::ParameterVector parameters;
+  auto boxes = makeInput({config.batch, config.boxes, 4}, InputKind::NormalizedBoxes, benchmarkCase, parameters);
+  auto scores = makeInput({config.batch, config.classes, config.boxes}, InputKind::Scores, benchmarkCase, parameters);
+
+  auto maxOutput = ov::opset8::Constant::create(ov::element::i64, ov::Shape{}, {100});
+  auto iouThreshold = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+  auto scoreThreshold = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {0.05f});
+  auto nms = std::make_shared<ov::opset8::NonMaxSuppression>(boxes, scores, maxOutput, iouThreshold, scoreThreshold);
+  return makeCase(nms, parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase matrixNms(const NmsModelConfig &config) {
+  NmsBenchmarkCase benchmarkCase;
+  ov::ParameterVector parameters;
+  auto boxes = makeInput({config.batch, config.boxes, 4}, InputKind::NormalizedBoxes, benchmarkCase, parameters);
+  auto scores = makeInput({config.batch, config.classes, config.boxes}, InputKind::Scores, benchmarkCase, parameters);
+
+  ov::opset8::MatrixNms::Attributes attrs;
+  attrs.score_threshold = 0.05f;
+  attrs.nms_top_k = 400;
+  attrs.keep_top_k = 200;
+  attrs.post_threshold = 0.05f;
+  attrs.background_class = 0;
+  return makeCase(std::make_shared<ov::opset8::MatrixNms>(boxes, scores, attrs), parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase multiclassNms(const NmsModelConfig &config) {
+  NmsBenchmarkCase benchmarkCase;
+  ov::ParameterVector parameters;
+  auto boxes = makeInput({config.batch, config.boxes, 4}, InputKind::NormalizedBoxes, benchmarkCase, parameters);
+  auto scores = makeInput({config.batch, config.classes, config.boxes}, InputKind::Scores, benchmarkCase, parameters);
+
+  ov::opset8::MulticlassNms::Attributes attrs;
+  attrs.iou_threshold = 0.5f;
+  attrs.score_threshold = 0.05f;
+  attrs.nms_top_k = 400;
+  attrs.keep_top_k = 200;
+  attrs.background_class = 0;
+  return makeCase(std::make_shared<ov::opset8::MulticlassNms>(boxes, scores, attrs), parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase proposal(const NmsModelConfig &config) {
+  const size_t anchors = 9;
+  const size_t featStride = 16;
+  const size_t side = featureSide(config.boxes, anchors);
+
+  NmsBenchmarkCase benchmarkCase;
+  benchmarkCase.imageSize = static_cast<float>(side * featStride);
+  ov::ParameterVector parameters;
+  auto classProbs = makeInput({config.batch, 2 * anchors, side, side}, InputKind::Scores, benchmarkCase, parameters);
+  auto bboxDeltas = makeInput({config.batch, 4 * anchors, side, side}, InputKind::Deltas, benchmarkCase, parameters);
+  auto imageShape = makeInput({3}, InputKind::ImageInfo, benchmarkCase, parameters);
+
+  ov::opset8::Proposal::Attributes attrs;
+  attrs.base_size = featStride;
+  attrs.pre_nms_topn = config.boxes;
+  attrs.post_nms_topn = 300;
+  attrs.nms_thresh = 0.7f;
+  attrs.feat_stride = featStride;
+  attrs.min_size = featStride;
+  attrs.ratio = {0.5f, 1.0f, 2.0f};
+  attrs.scale = {8.0f, 16.0f, 32.0f};
+  auto operation = std::make_shared<ov::opset8::Proposal>(classProbs, bboxDeltas, imageShape, attrs);
+  return makeCase(operation, parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase detectionOutput(const NmsModelConfig &config) {
+  NmsBenchmarkCase benchmarkCase;
+  ov::ParameterVector parameters;
+  auto locations = makeInput({config.batch, config.boxes * 4}, InputKind::Deltas, benchmarkCase, parameters);
+  auto confidences =
+      makeInput({config.batch, config.boxes * config.classes}, InputKind::Scores, benchmarkCase, parameters);
+  auto priors = makeInput({1, 1, config.boxes * 4}, InputKind::NormalizedBoxes, benchmarkCase, parameters);
+
+  ov::opset8::DetectionOutput::Attributes attrs;
+  attrs.background_label_id = 0;
+  attrs.top_k = 400;
+  attrs.keep_top_k = {200};
+  attrs.variance_encoded_in_target = true;
+  attrs.nms_threshold = 0.45f;
+  attrs.confidence_threshold = 0.05f;
+  attrs.normalized = true;
+  auto operation = std::make_shared<ov::opset8::DetectionOutput>(locations, confidences, priors, attrs);
+  return makeCase(operation, parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase experimentalDetectronDetectionOutput(const NmsModelConfig &config) {
+  NmsBenchmarkCase benchmarkCase;
+  benchmarkCase.imageSize = 800.f;
+  ov::ParameterVector parameters;
+  auto rois = makeInput({config.boxes, 4}, InputKind::PixelBoxes, benchmarkCase, parameters);
+  auto deltas = makeInput({config.boxes, config.classes * 4}, InputKind::Deltas, benchmarkCase, parameters);
+  auto scores = makeInput({config.boxes, config.classes}, InputKind::Scores, benchmarkCase, parameters);
+  auto imageInfo = makeInput({1, 3}, InputKind::ImageInfo, benchmarkCase, parameters);
+
+  ov::opset8::ExperimentalDetectronDetectionOutput::Attributes attrs;
+  attrs.score_threshold = 0.05f;
+  attrs.nms_threshold = 0.5f;
+  attrs.max_delta_log_wh = std::log(1000.0f / 16.0f);
+  attrs.num_classes = static_cast<int64_t>(config.classes);
+  attrs.post_nms_count = 2000;
+  attrs.max_detections_per_image = 100;
+  attrs.class_agnostic_box_regression = false;
+  attrs.deltas_weights = {10.0f, 10.0f, 5.0f, 5.0f};
+  auto operation =
+      std::make_shared<ov::opset8::ExperimentalDetectronDetectionOutput>(rois, deltas, scores, imageInfo, attrs);
+  return makeCase(operation, parameters, benchmarkCase);
+}
+
+NmsBenchmarkCase experimentalDetectronGenerateProposals(const NmsModelConfig &config) {
+  const size_t anchors = 3;
+  const size_t side = featureSide(config.boxes, anchors);
+
+  NmsBenchmarkCase benchmarkCase;
+  benchmarkCase.imageSize = static_cast<float>(side * 16);
+  ov::ParameterVector parameters;
+  auto imageInfo = makeInput({3}, InputKind::ImageInfo, benchmarkCase, parameters);
+  auto anchorBoxes = makeInput({side * side * anchors, 4}, InputKind::PixelBoxes, benchmarkCase, parameters);
+  auto deltas = makeInput({anchors * 4, side, side}, InputKind::Deltas, benchmarkCase, parameters);
+  auto scores = makeInput({anchors, side, side}, InputKind::Scores, benchmarkCase, parameters);
+
+  ov::opset8::ExperimentalDetectronGenerateProposalsSingleImage::Attributes attrs;
+  attrs.min_size = 0.0f;
+  attrs.nms_threshold = 0.7f;
+  attrs.post_nms_count = 1000;
+  attrs.pre_nms_count = static_cast<int64_t>(config.boxes);
+  auto operation = std::make_shared<ov::opset8::ExperimentalDetectronGenerateProposalsSingleImage>(
+      imageInfo, anchorBoxes, deltas, scores, attrs);
+  return makeCase(operation, parameters, benchmarkCase);
+}
+
+} // namespace
+
+std::vector<std::string> nmsOperations() {
+  return {"NonMaxSuppression", "MatrixNms", "MulticlassNms", "Proposal", "DetectionOutput",
+          "ExperimentalDetectronDetectionOutput", "ExperimentalDetectronGenerateProposalsSingleImage"};
+}
+
+NmsBenchmarkCase createNmsModel(const std::string &operation, const NmsModelConfig &config) {
+  if (operation == "NonMaxSuppression")
+    return nonMaxSuppression(config);
+  if (operation == "MatrixNms")
+    return matrixNms(config);
+  if (operation == "MulticlassNms")
+    return multiclassNms(config);
+  if (operation == "Proposal")
+    return proposal(config);
+  if (operation == "DetectionOutput")
+    return detectionOutput(config);
+  if (operation == "ExperimentalDetectronDetectionOutput")
+    return experimentalDetectronDetectionOutput(config);
+  if (operation == "ExperimentalDetectronGenerateProposalsSingleImage")
+    return experimentalDetectronGenerateProposals(config);
+  throw std::invalid_argument("Unsupported operation: " + operation);
+}
+
+void fillInput(ov::runtime::Tensor &tensor, InputKind kind, float imageSize, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+  float *data = tensor.data<float>();
+  const size_t size = tensor.get_size();
+
+  switch (kind) {
+  case InputKind::NormalizedBoxes:
+  case InputKind::PixelBoxes: {
+    // boxes take up to a fifth of the image side, so many of them overlap
+    const float scale = kind == InputKind::PixelBoxes ? imageSize : 1.0f;
+    for (size_t i = 0; i + 3 < size; i += 4) {
+      const float width = 0.02f + 0.2f * uniform(generator);
+      const float height = 0.02f + 0.2f * uniform(generator);
+      const float x0 = (1.0f - width) * uniform(generator);
+      const float y0 = (1.0f - height) * uniform(generator);
+      data[i] = x0 * scale;
+      data[i + 1] = y0 * scale;
+      data[i + 2] = (x0 + width) * scale;
+      data[i + 3] = (y0 + height) * scale;
+    }
+    break;
+  }
+  case InputKind::Scores:
+    for (size_t i = 0; i < size; i++)
+      data[i] = uniform(generator);
+    break;
+  case InputKind::Deltas:
+    for (size_t i = 0; i < size; i++)
+      data[i] = 0.2f * uniform(generator) - 0.1f;
+    break;
+  case InputKind::ImageInfo:
+    for (size_t i = 0; i < size; i++)
+      data[i] = i % 3 == 2 ? 1.0f : imageSize;
+    break;
+  }
+}
+
+} // namespace NmsBenchmark
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/core/model.hpp>
+#include <openvino/runtime/tensor.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NmsBenchmark {
+
+/**
+ * @brief Sizes of the generated problems
+ */
+struct NmsModelConfig {
+  size_t boxes = 1000;  // number of input boxes (anchors, priors, ROIs) per image
+  size_t classes = 20;  // number of classes for multi-class operations
+  size_t batch = 1;  // number of images for batched operations
+};
+
+/**
+ * @brief Content of a model input, used to generate data in a valid range
+ */
+enum class InputKind {
+  NormalizedBoxes,  // corner boxes in [0, 1]
+  PixelBoxes,  // corner boxes in [0, imageSize]
+  Scores,  // values in [0, 1]
+  Deltas,  // small box regression deltas
+  ImageInfo,  // image height, width and scale
+};
+
+/**
+ * @brief A model with a single NMS-family operation and kinds of its inputs
+ */
+struct NmsBenchmarkCase {
+  std::shared_ptr<ov::Model> model;
+  std::vector<InputKind> inputs;
+  float imageSize = 1.f;
+};
+
+/**
+ * @brief Names of the operations createNmsModel() supports
+ */
+std::vector<std::string> nmsOperations();
+
+/**
+ * @brief Creates a model with the operation, the attributes are typical for detection models
+ */
+NmsBenchmarkCase createNmsModel(const std::string &operation, const NmsModelConfig &config);
+
+/**
+ * @brief Fills the tensor with pseudo-random data of the kind, the same seed gives the same data
+ */
+void fillInput(ov::runtime::Tensor &tensor, InputKind kind, float imageSize, unsigned seed);
+
+} // namespace NmsBenchmark
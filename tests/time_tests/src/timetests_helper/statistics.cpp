@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timetests_helper/statistics.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace TimeTest {
+
+void DurationStatistics::add(const std::string &name, double duration) {
+  if (durations.find(name) == durations.end())
+    order.push_back(name);
+  durations[name].push_back(duration);
+}
+
+void DurationStatistics::setMax(const std::string &name, const std::string &field, size_t value) {
+  auto &current = fields[name][field];
+  current = std::max(current, value);
+}
+
+void DurationStatistics::writeJson(std::ostream &out, const std::string &entries,
+                                   const std::map<std::string, std::string> &info) const {
+  out << "{\n";
+  for (const auto &item : info)
+    out << "  \"" << item.first << "\": " << item.second << ",\n";
+  out << "  \"measurement_unit\": \"ms\",\n";
+  out << "  \"" << entries << "\": [\n";
+  for (size_t i = 0; i < order.size(); i++) {
+    auto values = durations.at(order[i]);
+    std::sort(values.begin(), values.end());
+    out << "    {\"name\": " << quoted(order[i])
+        << ", \"iterations\": " << values.size()
+        << ", \"min\": " << values.front()
+        << ", \"median\": " << values[values.size() / 2]
+        << ", \"max\": " << values.back();
+    const auto entryFields = fields.find(order[i]);
+    if (entryFields != fields.end()) {
+      for (const auto &field : entryFields->second)
+        out << ", \"" << field.first << "\": " << field.second;
+    }
+    out << "}" << (i + 1 < order.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+std::string quoted(const std::string &value) {
+  std::string result = "\"";
+  for (const char c : value) {
+    if (c == '"' || c == '\\')
+      result += '\\';
+    result += c;
+  }
+  return result + "\"";
+}
+
+bool writeStatistics(const std::string &path, const DurationStatistics &statistics, const std::string &entries,
+                     const std::map<std::string, std::string> &info) {
+  std::ofstream statisticsFile(path);
+  if (!statisticsFile.good()) {
+    std::cerr << "Statistic file \"" << path << "\" can't be used for writing" << std::endl;
+    return false;
+  }
+  statistics.writeJson(statisticsFile, entries, info);
+  return statisticsFile.good();
+}
+
+} // namespace TimeTest